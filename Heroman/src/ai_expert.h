@@ -0,0 +1,319 @@
+#pragma once
+
+#include <atomic>
+#include "simulation.h"
+
+// AI_EXPERT: lookahead search over copies of the simulation
+//
+// The other personalities react to the opponent's current animation and a
+// distance threshold. AI_EXPERT instead plays every pair of moves (its own
+// and the opponent's) forward on plain struct copies of the GameState with
+// lookaheadStep(), a move at a time down to LOOKAHEAD_MAX_DEPTH, and picks
+// the move that scores best against the opponent's replies. A move is
+// scored mostly against the opponent carrying on with what it is pressing
+// now, and partly against its best reply: pure worst-case minimax assumes
+// every approach gets punched and stalls into standoffs.
+//
+// The search deepens one move at a time until the budget runs out, and
+// only the deepest search that finished counts. If not even the first one
+// finished, the controller has no plan and ai_expert_behavior() falls back
+// to the balanced personality.
+//
+// A search is started for the state after tick N and its move is played
+// from tick N + 1, the tick on which the controller decides anew:
+//  - On the device, lookaheadPost() hands the state to a task on core 1,
+//    which searches between frames, and lookaheadCollect() picks the result
+//    up before the next tick.
+//  - Headless tools call lookaheadThink() before each step() instead.
+// Both stop at LOOKAHEAD_NODES, so they search the same tree and pick the
+// same move. The device also stops at a microsecond deadline, and drops a
+// result that arrives after its tick, so under load it can play a shallower
+// search or fall back to balanced where a headless run would not - host
+// matches show the AI at its best, not always as the device plays it.
+
+#define LOOKAHEAD_HOLD_TICKS 4       // Each searched move is held this long
+#define LOOKAHEAD_MAX_DEPTH 2        // Moves per fighter in the deepest search
+#define LOOKAHEAD_CAUTION 1          // Quarters of a move's score from the opponent's best reply
+#define LOOKAHEAD_BUDGET_US 5000     // Per search on the device, on top of the node cap - well inside a 40ms tick
+#define LOOKAHEAD_NODES 500          // Per search, about what the device manages in LOOKAHEAD_BUDGET_US
+#define LOOKAHEAD_CLOCK_INTERVAL 8   // Nodes between clock reads
+#define LOOKAHEAD_WIN 100000         // Score of a knockout
+#define LOOKAHEAD_BRANCHING (LOOKAHEAD_MOVE_COUNT * (LOOKAHEAD_MOVE_COUNT + 1))  // Move pairs per depth
+
+// Moves the search chooses between, for both fighters
+enum LookaheadMove : uint8_t {
+    LOOK_IDLE,
+    LOOK_FORWARD,
+    LOOK_BACK,
+    LOOK_PUNCH_HIGH,
+    LOOK_PUNCH_LOW,
+    LOOK_SQUAT,
+    LOOK_SQUAT_PUNCH_HIGH,
+    LOOK_SQUAT_PUNCH_LOW,
+    LOOKAHEAD_MOVE_COUNT,
+    LOOK_CONTINUE = LOOKAHEAD_MOVE_COUNT  // Opponent's reply only: keep pressing what it presses now
+};
+
+// Buttons for a move, made by fighter self facing the other
+uint32_t lookaheadButtons(uint8_t move, const GameState& gs, uint8_t self) {
+    bool moveRight = gs.observation.fighters[self].otherSide > 0;
+
+    switch (move) {
+        case LOOK_FORWARD:
+            return createButtonState(false, false, !moveRight, moveRight, false, false, false);
+        case LOOK_BACK:
+            return createButtonState(false, false, moveRight, !moveRight, false, false, false);
+        case LOOK_PUNCH_HIGH:
+            return createButtonState(false, false, false, false, true, false, false);
+        case LOOK_PUNCH_LOW:
+            return createButtonState(false, false, false, false, false, true, false);
+        case LOOK_SQUAT:
+            return createButtonState(false, true, false, false, false, false, false);
+        case LOOK_SQUAT_PUNCH_HIGH:
+            return createButtonState(false, true, false, false, true, false, false);
+        case LOOK_SQUAT_PUNCH_LOW:
+            return createButtonState(false, true, false, false, false, true, false);
+        case LOOK_CONTINUE:
+            return (self == 0) ? gs.player1.ctrlState : gs.player2.ctrlState;
+        default:
+            return 0xFFFFFFFF;  // Idle
+    }
+}
+
+// When a search has to stop - either limit may be 0 for none
+struct LookaheadBudget {
+    int64_t deadline;    // esp_timer_get_time() to stop at
+    uint32_t maxNodes;
+};
+
+struct LookaheadSearch {
+    uint8_t self;              // Index of the searching fighter
+    LookaheadBudget budget;
+    uint32_t nodes;            // Move pairs played, LOOKAHEAD_HOLD_TICKS ticks each
+    int64_t start;             // esp_timer_get_time() when the search began
+    bool outOfBudget;
+};
+
+inline bool lookaheadFightOver(const GameState& gs) {
+    return gs.gameState != GAME_PLAYING && gs.gameState != GAME_MENU;
+}
+
+// How good gs is for fighter self: health first, then being ready to
+// punch, then being close enough to
+int lookaheadEvaluate(const GameState& gs, uint8_t self) {
+    const Player& me = (self == 0) ? gs.player1 : gs.player2;
+    const Player& them = (self == 0) ? gs.player2 : gs.player1;
+
+    if (them.isDead) return LOOKAHEAD_WIN;
+    if (me.isDead) return -LOOKAHEAD_WIN;
+
+    int score = 100 * (me.health - them.health);
+    if (me.canPunch) score += 20;
+    if (them.canPunch) score -= 20;
+    score -= gs.observation.distance / 2;
+    return score;
+}
+
+// Play one move pair forward on gs
+void lookaheadPlay(GameState& gs, uint8_t self, uint8_t myMove, uint8_t theirMove) {
+    uint32_t mine = lookaheadButtons(myMove, gs, self);
+    uint32_t theirs = lookaheadButtons(theirMove, gs, 1 - self);
+
+    for (int t = 0; t < LOOKAHEAD_HOLD_TICKS && !lookaheadFightOver(gs); t++) {
+        if (self == 0) {
+            lookaheadStep(gs, mine, theirs);
+        } else {
+            lookaheadStep(gs, theirs, mine);
+        }
+    }
+}
+
+bool lookaheadSpent(LookaheadSearch* s) {
+    if (s->outOfBudget) return true;
+    if (s->budget.maxNodes != 0 && s->nodes >= s->budget.maxNodes) {
+        s->outOfBudget = true;
+    } else if (s->budget.deadline != 0 && s->nodes % LOOKAHEAD_CLOCK_INTERVAL == 0 &&
+               esp_timer_get_time() >= s->budget.deadline) {
+        s->outOfBudget = true;
+    }
+    return s->outOfBudget;
+}
+
+// A search one move deeper takes about LOOKAHEAD_BRANCHING times as long
+// as everything so far - not worth starting if it cannot finish
+bool lookaheadCanDeepen(const LookaheadSearch* s) {
+    if (s->budget.maxNodes != 0 && (uint64_t)s->nodes * LOOKAHEAD_BRANCHING > s->budget.maxNodes) {
+        return false;
+    }
+    if (s->budget.deadline != 0) {
+        int64_t now = esp_timer_get_time();
+        if (now + (now - s->start) * LOOKAHEAD_BRANCHING > s->budget.deadline) return false;
+    }
+    return true;
+}
+
+int lookaheadBest(LookaheadSearch* s, const GameState& gs, int depth, uint8_t* bestMove);
+
+// Score of myMove against the opponent's replies: mostly against the one
+// it is making now, partly against its best
+int lookaheadReplies(LookaheadSearch* s, const GameState& gs, uint8_t myMove, int depth) {
+    int predicted = 0;
+    int worst = LOOKAHEAD_WIN;
+    for (uint8_t theirMove = 0; theirMove <= LOOK_CONTINUE; theirMove++) {
+        if (lookaheadSpent(s)) return 0;
+
+        GameState child = gs;
+        lookaheadPlay(child, s->self, myMove, theirMove);
+        s->nodes++;
+
+        int value = lookaheadBest(s, child, depth - 1, nullptr);
+        if (theirMove == LOOK_CONTINUE) predicted = value;
+        if (value < worst) worst = value;
+    }
+    return ((4 - LOOKAHEAD_CAUTION) * predicted + LOOKAHEAD_CAUTION * worst) / 4;
+}
+
+// Score of the best move in gs; *bestMove, if given, receives that move
+int lookaheadBest(LookaheadSearch* s, const GameState& gs, int depth, uint8_t* bestMove) {
+    if (depth == 0 || lookaheadFightOver(gs)) return lookaheadEvaluate(gs, s->self);
+
+    int best = -LOOKAHEAD_WIN - 1;
+    for (uint8_t move = 0; move < LOOKAHEAD_MOVE_COUNT; move++) {
+        int value = lookaheadReplies(s, gs, move, depth);
+        if (s->outOfBudget) return 0;
+        if (value > best) {
+            best = value;
+            if (bestMove) *bestMove = move;
+        }
+    }
+    return best;
+}
+
+// One search, from the state after a tick to a move for the next one
+struct LookaheadJob {
+    GameState state;      // Copy to search from
+    uint8_t self;         // Fighter to move
+    bool found;           // At least the first depth finished
+    uint8_t depth;        // Deepest finished search
+    uint32_t nodes;
+    uint32_t action;      // Buttons to hold for LOOKAHEAD_HOLD_TICKS
+};
+
+void lookaheadRun(LookaheadJob* job, const LookaheadBudget& budget) {
+    LookaheadSearch s = { job->self, budget, 0, esp_timer_get_time(), false };
+    job->state.lookahead = true;
+    job->found = false;
+    job->depth = 0;
+
+    uint8_t best = LOOK_IDLE;
+    for (int depth = 1; depth <= LOOKAHEAD_MAX_DEPTH; depth++) {
+        if (depth > 1 && !lookaheadCanDeepen(&s)) break;
+
+        uint8_t move = best;
+        lookaheadBest(&s, job->state, depth, &move);
+        if (s.outOfBudget) break;
+        best = move;
+        job->found = true;
+        job->depth = depth;
+    }
+    job->nodes = s.nodes;
+
+    job->action = lookaheadButtons(best, job->state, job->self);
+}
+
+AIController* lookaheadController(GameState& gs, uint8_t index) {
+    return (index == 0) ? &gs.aiPlayer1 : &gs.aiPlayer2;
+}
+
+// Will this controller pick a new move on the next tick?
+// Never while TickInputs::overrideAI drives the fighters (playback, attract
+// mode): nothing would play the plan, and step() clears it anyway.
+bool lookaheadWanted(const GameState& gs, const AIController* ai, const TickInputs& in) {
+    return !in.overrideAI && ai->enabled && ai->personality == AI_EXPERT && ai->actionDuration == 0 &&
+           ai->plannedDuration == 0 && !lookaheadFightOver(gs);
+}
+
+// Hand a finished search to its controller
+void lookaheadApply(GameState& gs, const LookaheadJob& job) {
+    LOG_EVENT(EV_AI_LOOKAHEAD, job.self + 1, job.depth, job.nodes, job.action);
+    if (!job.found) return;  // Out of budget - the heuristic decides
+
+    AIController* ai = lookaheadController(gs, job.self);
+    ai->plannedAction = job.action;
+    ai->plannedDuration = LOOKAHEAD_HOLD_TICKS;
+}
+
+// Search in place for every AI_EXPERT about to decide - call before
+// step(gs, in). Used by headless tools: with the node cap alone, runs stay
+// reproducible from the seed.
+void lookaheadThink(GameState& gs, const TickInputs& in, uint32_t maxNodes = LOOKAHEAD_NODES) {
+    LookaheadBudget budget = { 0, maxNodes };
+    for (uint8_t i = 0; i < 2; i++) {
+        if (!lookaheadWanted(gs, lookaheadController(gs, i), in)) continue;
+
+        LookaheadJob job;
+        job.state = gs;
+        job.self = i;
+        lookaheadRun(&job, budget);
+        lookaheadApply(gs, job);
+    }
+}
+
+// ---- Search on the other core (device) ----
+
+#define LOOKAHEAD_IDLE 0    // Owned by the simulation
+#define LOOKAHEAD_POSTED 1  // Owned by the search task
+#define LOOKAHEAD_DONE 2    // Back with the simulation, result filled in
+
+struct LookaheadMailbox {
+    LookaheadJob job;
+    std::atomic<uint8_t> stage;
+};
+
+LookaheadMailbox lookaheadMail[2];
+
+// After step(gs, in): post a search for every AI_EXPERT about to decide
+// The next tick's inputs are not known yet, so in - the tick just played -
+// stands in for them; lookaheadCollect() checks the real ones. Returns true
+// if the search task has work.
+bool lookaheadPost(const GameState& gs, const TickInputs& in) {
+    bool posted = false;
+    for (uint8_t i = 0; i < 2; i++) {
+        LookaheadMailbox* mail = &lookaheadMail[i];
+        if (!lookaheadWanted(gs, i == 0 ? &gs.aiPlayer1 : &gs.aiPlayer2, in)) continue;
+        if (mail->stage.load(std::memory_order_acquire) != LOOKAHEAD_IDLE) continue;  // Still searching
+
+        mail->job.state = gs;
+        mail->job.self = i;
+        mail->stage.store(LOOKAHEAD_POSTED, std::memory_order_release);
+        posted = true;
+    }
+    return posted;
+}
+
+// Before step(gs, in): apply searches that finished since the last tick
+// A search that finished late, for an older tick, is dropped, and so is
+// one for a tick whose AI in overrides.
+void lookaheadCollect(GameState& gs, const TickInputs& in) {
+    for (uint8_t i = 0; i < 2; i++) {
+        LookaheadMailbox* mail = &lookaheadMail[i];
+        if (mail->stage.load(std::memory_order_acquire) != LOOKAHEAD_DONE) continue;
+
+        if (mail->job.state.tick == gs.tick && !in.overrideAI) {
+            lookaheadApply(gs, mail->job);
+        }
+        mail->stage.store(LOOKAHEAD_IDLE, std::memory_order_release);
+    }
+}
+
+// Search task side: run every posted search, capped by nodes and by the clock
+void lookaheadServe() {
+    for (uint8_t i = 0; i < 2; i++) {
+        LookaheadMailbox* mail = &lookaheadMail[i];
+        if (mail->stage.load(std::memory_order_acquire) != LOOKAHEAD_POSTED) continue;
+
+        LookaheadBudget budget = { esp_timer_get_time() + LOOKAHEAD_BUDGET_US, LOOKAHEAD_NODES };
+        lookaheadRun(&mail->job, budget);
+        mail->stage.store(LOOKAHEAD_DONE, std::memory_order_release);
+    }
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "player.h"
+#include "animation.h"
+#include "observation.h"
+
+// AI_NEURAL: a small policy network trained by self-play
+//
+// src/host/train_neural.cpp trains the network headlessly against the real
+// simulation and writes it to ai_neural_weights.h as int8 weights. Inference
+// is integer-only, so the host and the device pick exactly the same moves and
+// replays and state hashes stay valid.
+//
+// Every activation is Q7: an int8_t from 0 to 127 standing for 0 to 127/128.
+// A layer's weights are int8 scaled by 2^shift, so its int32 accumulator
+// holds the real sum scaled by 2^(shift + 7) and the next layer's input is
+// the accumulator >> shift, clamped to 0..127 (a ReLU capped at 1.0). The
+// last layer's accumulators are compared as they are - the largest picks
+// the move.
+//
+// Every layer reads NEURAL_WIDTH inputs, so the inner loop has a constant
+// trip count the compiler unrolls. About 650 multiply-adds per decision.
+
+#define NEURAL_WIDTH 16           // Inputs, and the width of each hidden layer
+#define NEURAL_LAYERS 3
+#define NEURAL_OUTPUTS AI_MOVE_COUNT
+#define NEURAL_ONE 127            // Q7 1.0, near enough
+#define NEURAL_HOLD_TICKS 3       // Each decision is held this long
+
+struct NeuralLayer {
+    const int8_t* weights;  // [outputs][NEURAL_WIDTH], row-major
+    const int32_t* bias;    // [outputs], in accumulator units
+    uint8_t outputs;
+    uint8_t shift;          // Weights are the real values scaled by 2^shift
+};
+
+struct NeuralNet {
+    NeuralLayer layers[NEURAL_LAYERS];
+};
+
+#include "ai_neural_weights.h"
+
+inline int8_t neuralClamp(int value) {
+    return value < 0 ? 0 : (value > NEURAL_ONE ? NEURAL_ONE : value);
+}
+
+inline int8_t neuralFlag(bool set) {
+    return set ? NEURAL_ONE : 0;
+}
+
+// What the network sees, from the AI's side: NEURAL_WIDTH Q7 inputs
+// Flags and distance come from the tick's Observation; the cooldowns,
+// animation timing and health it does not hold are read off the fighters.
+void neuralObserve(const Observation& o, const Player* self, const Player* opponent, int8_t* x) {
+    const FighterView& mine = o.fighters[self->playerNumber - 1];
+    const FighterView& theirs = o.fighters[opponent->playerNumber - 1];
+
+    x[0] = neuralClamp(o.distance);  // 1.0 is 128 pixels
+    x[1] = neuralFlag(mine.canPunch);
+    x[2] = neuralClamp(self->punchCooldown * 12);
+    x[3] = neuralFlag(mine.isHit);
+    x[4] = neuralClamp(self->hitCooldown * 8);
+    x[5] = neuralFlag(mine.flags & ANIM_ATTACK);
+    x[6] = neuralFlag(mine.flags & ANIM_SQUAT);
+    x[7] = neuralFlag(mine.flags & ANIM_LOCKED);
+    x[8] = neuralFlag(theirs.flags & ANIM_ATTACK);
+    x[9] = neuralFlag(theirs.flags & ANIM_SQUAT);
+    x[10] = neuralFlag(theirs.flags & ANIM_HIGH);
+    x[11] = neuralFlag(theirs.isHit);
+    x[12] = neuralFlag(theirs.canPunch);
+    x[13] = neuralClamp(opponent->animationFrameIndex * 32 + opponent->animationDelayCounter * 16);
+    x[14] = neuralClamp(self->health * NEURAL_ONE / 100);
+    x[15] = neuralClamp(opponent->health * NEURAL_ONE / 100);
+}
+
+// acc[o] = bias[o] + sum of weights[o][i] * in[i]
+void neuralDense(const NeuralLayer& layer, const int8_t* in, int32_t* acc) {
+    const int8_t* w = layer.weights;
+    for (int o = 0; o < layer.outputs; o++) {
+        int32_t sum = layer.bias[o];
+        for (int i = 0; i < NEURAL_WIDTH; i++) {
+            sum += (int32_t)w[i] * in[i];
+        }
+        acc[o] = sum;
+        w += NEURAL_WIDTH;
+    }
+}
+
+// Run the network on one observation and return the AIMove it picks
+uint8_t neuralDecide(const NeuralNet& net, const int8_t* observation) {
+    int8_t activations[NEURAL_WIDTH];
+    int32_t acc[NEURAL_WIDTH];
+    const int8_t* in = observation;
+
+    for (int l = 0; l < NEURAL_LAYERS - 1; l++) {
+        const NeuralLayer& layer = net.layers[l];
+        neuralDense(layer, in, acc);
+        for (int o = 0; o < NEURAL_WIDTH; o++) {
+            activations[o] = neuralClamp(acc[o] >> layer.shift);
+        }
+        in = activations;
+    }
+
+    const NeuralLayer& last = net.layers[NEURAL_LAYERS - 1];
+    neuralDense(last, in, acc);
+    uint8_t best = 0;
+    for (uint8_t o = 1; o < last.outputs; o++) {
+        if (acc[o] > acc[best]) best = o;
+    }
+    return best;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+#include <pgmspace.h>
+
+// Generated by  : src/host/train_neural.cpp - do not edit by hand
+// Training      : 600 generations of self-play, seed 1
+// Win/loss      : AGGRESSIVE 100%/0%, DEFENSIVE 100%/0%, BALANCED 100%/0%, RANDOM 100%/0%, EXPERT 0%/0%
+//
+// Int8 weights of the AI_NEURAL policy network - see ai_neural.h for the format.
+
+constexpr int8_t neural_weights_0[NEURAL_WIDTH * NEURAL_WIDTH] PROGMEM = {
+     -56,    0,  -25,  -27,  -14,   -9,   33,   13,   -6,   68,   69,  -23,    9,   72,   13,   17,
+     -33,   25,  -85,  -36,   21,   34,   21,    8,   38, -117,  -39,  -40,  -14,  -51,   23,   10,
+     -38,   -4,   44,   58,   25,   -9,    1,   18,   25,  -21,   25,   69,    5,  -34,  -34,   -1,
+      22,  -55,   -4,  -27,    0,  -35,  -15,  -19,  -83,  -35,   -8,   35,   59,   38,   51,    3,
+      16,    8,  -19,   15,   15,   60,    2,  -69,  -34,  -36,  100,   15,    3,  -34,  -96,   20,
+     -25,   30,  -69,  -22,  -46,  -43,   -4,    9,  -57,  -20,  -25,  -25,  -14,  -67,   -9,   38,
+     -46,   -7,   14,   -5,   -2,  -30,    0,   11,   -9,    5,  -23,   12,   20,    0,  -15,   -5,
+     -28,  -14,   -2,  -84,   10,   11,   42,    3, -102,    3,  -24,   52,  -51,   33,    8,  -28,
+      87,   42,  -41,  -60,   25,  -24,   69,   45,   21,   71,   24,   23,   16,   42,  -44,    2,
+      29,   10,  -66,  -10,    4,   19,   47,  -95,   11,  -54,    1,  -48,  -30,   25,  -12,    0,
+      29,    3,  -37, -103,   15,   -1,  -15,   47,   42,  -51,  -48,   -8,  -80,   -2,    5,    9,
+      13,  -63,  -13,   32,  -71,   -9,  -18,   24,   71,  -12,  -22,    8,   10,    0,   21,  -21,
+      -8,   31,   14,   -8,   -2,  -19,  -17,   81,    9,   -2,  -29,  -68,  -17,   16,   30,   13,
+     -28,  -14,   28,  -32,   26,    7,  -17,   35,   -9,  -79,  -32,  -40,   16,   33,   -8,    2,
+       4,   26,  -37,  -50,  -20,  125,   -1,   71,   16,   28,   -6,    0,    1,  -44,  -17,   -7,
+      36,   55,  -29,  -67,   -7,   79,   13,  -17,   40,  -67, -119,   59,   28,    0,   27,  -22,
+};
+constexpr int32_t neural_bias_0[NEURAL_WIDTH] PROGMEM = {
+    1592, 101, -169, 142, -114, -6936, 4426, 1086, 2949, 1807, -1385, 3999, -4387, -6140, -516, -2260,
+};
+
+constexpr int8_t neural_weights_1[NEURAL_WIDTH * NEURAL_WIDTH] PROGMEM = {
+      49,   58,  -16,   55,    6,   91,   18,  -38,   91,    7,  -39,   25,  -24,  -19,   25,    9,
+       5,   45,  -32,   80,   53,   -2,  -39,   -6,   -3,   81,   32,   -8,  -17,   28,   -1,   75,
+      49,  -31,   10,   26,  -79,   53,  -34,  -27,   12,  -42,  -37,  -40,  -42,   12,  -10,    2,
+      14,  -90,  -62,  -29,  -52,  -12,   19,   -6,    8,  -52,  -23,   15,    2,   10,   68,  -33,
+      -2,  -70,  -12,   -6,    1,  -21,    7,    0,  -55,   -5,  -12,   16,   48,   68,   40,   13,
+     -52,  -65,  -23,   40,  -49,  -57,    8,   11,   10,  -76,    0,  -56,   61,  -50,  -21,  -71,
+     -17,   25,   47,  -36,  -24,  -22,   14,    5,   -9,   -7,   52,  -21,  -29,   25,   53,   60,
+     -47,  -51,   29,   50,   15,   45,    0,  -13,  -22,   18,    4,  -15,  -35,   -4,   15,  -18,
+     -45,  -26,  -32,  -47,  -14,   46,  -21,  -26,   35,   32,   24,   13,   57,   27,   -8,    7,
+      37,    1,   16,  -15,   82,   38,  -42,  -19,   -2,   23,  -17,    0,  -70,    3,  -43,   76,
+      25,   42,   34,  -31,    1,   33,  -64,  -49,  -11,  -31,   29,  -12,  -17,  -13,   -7,    5,
+     -27,    3,  -20,  -19,   -8,   -2,  -27,    2,   34,   61,  -31,    6,  -43,   16,    7,  -28,
+      29,   47,  -29,   37,   14,  -73,  -59,  -14,   46,    4,   -8,   19,   -4,    6,   55,  -62,
+     -43,   40,  -56,   25,   11,    6,   13,   -6,   20,    3,  -61,   15,    4,    0,   35,   51,
+      -5,  -24,   -2,   74,   14,   20,   26,  -16,  -39,   17,  -61,   40,   19,  -34,   38,  -43,
+     -21,   -3,   37,    4,   -3,   -2,   15,  -22,  -14,    6,   -6,  -15,  -25,  -18,   -6,   26,
+};
+constexpr int32_t neural_bias_1[NEURAL_WIDTH] PROGMEM = {
+    -4854, -1950, -5483, 2895, -3495, 1384, 2606, 288, -5192, -3566, -5709, -5409, -9878, -1728, -1550, 1349,
+};
+
+constexpr int8_t neural_weights_2[NEURAL_OUTPUTS * NEURAL_WIDTH] PROGMEM = {
+    -119,    3,   11,   -5,  -15,   32,   43,  -11,   93,  -16, -111,   11,  -18,    1,  -11,   31,
+      56,   68,    9,   -4,  -42,    2,  -12,  -13,  -55,  -34,   75,  -66,   17,   13,   32,   -6,
+     -48,   11,   15,   43,  -74,   -4,    9,   67,  -23,   -1,   45,   19,   20,  -32,  -35,  -20,
+      56,   66,  -83,  -22,   52,  -41,   60,   20,  -61,   20,    5,  -36,  -24,  -12,  -27,    2,
+      23,   32,  -31,  -22,    5,  -12,    0,   23,  -14,  -15,   -6,  -34,  -41,   -4,   18,   30,
+     -43,  -17,  -39,  -22,   68,  -28,  -14,  -12,    1,   -2,  -51,  -17,  -49,   67,   63,   -7,
+      13,   -5,   63,   27,  -66,   21,  -22,   41,   29,   39,   28,  -10,    1,  -37,    5,   -3,
+      80,  -34,   -4,   53,   15,  -80,   57,  -23,   -4,   26,   66,   27,  -20,   16,  -20,  -41,
+      17,   10,   -5,   45,    3,  -21,   29,  -11,   27,  -10,   60,  -61,  -43,    8,  -13,   10,
+};
+constexpr int32_t neural_bias_2[NEURAL_OUTPUTS] PROGMEM = {
+    10103, -860, 4079, 2047, -5457, -3107, -5621, -1073, -2175,
+};
+
+constexpr NeuralNet neural_net = { {
+    { neural_weights_0, neural_bias_0, NEURAL_WIDTH, 6 },
+    { neural_weights_1, neural_bias_1, NEURAL_WIDTH, 6 },
+    { neural_weights_2, neural_bias_2, NEURAL_OUTPUTS, 6 },
+} };
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "player.h"
-#include "controller.h"
+#include "ctrl_state.h"
+#include "animation.h"
+#include "event_log.h"
+#include "observation.h"
 #include <stdlib.h>
 
 // AI Personality Types
@@ -9,23 +12,58 @@ enum AIPersonality {
     AI_AGGRESSIVE,   // Rushdown style, lots of attacks
     AI_DEFENSIVE,    // Blocks often, counterattacks
     AI_BALANCED,     // Mix of offense and defense
-    AI_RANDOM        // Random actions (beginner AI)
+    AI_RANDOM,       // Random actions (beginner AI)
+    AI_EXPERT,       // Searches ahead on copies of the simulation (ai_expert.h)
+    AI_NEURAL        // Self-play trained policy network (ai_neural.h)
 };
 
+struct NeuralNet;
+struct AIParams;
+
 // AI Controller State
 struct AIController {
     bool enabled;              // Is AI active for this player?
     AIPersonality personality; // AI behavior type
     Player* self;              // Pointer to AI's player
     Player* opponent;          // Pointer to opponent player
+    const Observation* observation;  // Both fighters this tick, kept by the simulation
     int decisionTimer;         // Frames until next decision
     uint32_t currentAction;    // Current button state being held
     int actionDuration;        // How long to hold current action
+    int debugCounter;          // Decisions since init, paces the status log
+    int balancedDebugCounter;  // Balanced-behavior calls, paces its log
+    uint32_t rngState;         // Private random stream, see aiRandom()
+    uint32_t plannedAction;    // AI_EXPERT: move found by the lookahead search
+    int plannedDuration;       // Ticks to hold it, 0 if there is no plan
+    const NeuralNet* net;      // AI_NEURAL: network to run, neural_net unless training
+    const AIParams* params;    // Tuning only: run the behavior functions with these, not the policy table
 };
 
+// Random numbers for AI decisions
+// Each controller owns a small xorshift generator seeded in initAI(), so a
+// match replays exactly from its seed and inputs, and controllers never
+// share state (libc rand() is global, and locked on the host).
+void aiSeedRandom(AIController* ai, uint32_t seed) {
+    // Scramble so nearby seeds start far apart
+    seed ^= seed >> 16;
+    seed *= 0x7FEB352Du;
+    seed ^= seed >> 15;
+    seed *= 0x846CA68Bu;
+    seed ^= seed >> 16;
+    ai->rngState = seed ? seed : 0x9E3779B9u;  // xorshift never leaves zero
+}
+
+// Non-negative pseudo-random int, like rand()
+inline int aiRandom(AIController* ai) {
+    uint32_t x = ai->rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    ai->rngState = x;
+    return (int)(x >> 1);
+}
+
 // Helper functions to enable/disable AI
-// IMPORTANT: These must be defined BEFORE heroman.h is included
-// because heroman.h uses these functions in its game state logic
 inline void enableAI(AIController* ai) {
     if (ai) ai->enabled = true;
 }
@@ -38,14 +76,33 @@ inline bool isAIEnabled(AIController* ai) {
     return (ai && ai->enabled);
 }
 
-// Include heroman.h AFTER helper functions so they're available when heroman.h needs them
-#include "heroman.h"
+// Forget an AI_EXPERT plan that will not be played
+inline void clearAIPlan(AIController* ai) {
+    ai->plannedAction = 0xFFFFFFFF;
+    ai->plannedDuration = 0;
+}
+
+// The AI's own fighter and its opponent, as this tick's observation shows them
+inline const FighterView& aiSelf(const AIController* ai) {
+    return ai->observation->fighters[ai->self->playerNumber - 1];
+}
+
+inline const FighterView& aiOpponent(const AIController* ai) {
+    return ai->observation->fighters[ai->opponent->playerNumber - 1];
+}
+
+// Moving toward the opponent means pressing right
+inline bool aiOpponentOnRight(const AIController* ai) {
+    return aiSelf(ai).otherSide > 0;
+}
 
 // Forward declarations
 uint32_t ai_aggressive_behavior(AIController* ai, int distance, int* duration);
 uint32_t ai_defensive_behavior(AIController* ai, int distance, int* duration);
 uint32_t ai_balanced_behavior(AIController* ai, int distance, int* duration);
 uint32_t ai_random_behavior(AIController* ai, int* duration);
+uint32_t ai_expert_behavior(AIController* ai, int distance, int* duration);
+uint32_t ai_neural_behavior(AIController* ai, int* duration);
 
 // Helper function: Create button state from individual button bools
 uint32_t createButtonState(bool up, bool down, bool left, bool right,
@@ -63,66 +120,188 @@ uint32_t createButtonState(bool up, bool down, bool left, bool right,
     return state;
 }
 
-// AI Range Constants
-#define PUNCH_RANGE 35          // Distance where punches can hit
-#define CLOSE_RANGE 45          // Very close combat range
-#define MEDIUM_RANGE 70         // Medium distance
-#define SAFE_DEFENSIVE_RANGE 50 // Defensive AI preferred distance
+// Moves the AI chooses between, relative to the opponent so one decision
+// serves both sides of the arena
+enum AIMove : uint8_t {
+    AI_MOVE_IDLE,
+    AI_MOVE_FORWARD,          // Toward the opponent
+    AI_MOVE_BACK,             // Away from the opponent
+    AI_MOVE_PUNCH,
+    AI_MOVE_LOW_PUNCH,
+    AI_MOVE_SQUAT_LOW_PUNCH,
+    AI_MOVE_BLOCK,
+    AI_MOVE_SQUAT_BLOCK,
+    AI_MOVE_SQUAT,
+    AI_MOVE_COUNT
+};
+
+// Buttons held for each move, indexed by move and then by whether the
+// opponent is to the right (pressed bits are cleared, like createButtonState())
+#define AI_PRESS(button) (0xFFFFFFFFu & ~(1u << (button)))
+constexpr uint32_t aiMoveButtonTable[AI_MOVE_COUNT][2] = {
+    { 0xFFFFFFFFu, 0xFFFFFFFFu },                                  // AI_MOVE_IDLE
+    { AI_PRESS(LEFT_BTN), AI_PRESS(RIGHT_BTN) },                   // AI_MOVE_FORWARD
+    { AI_PRESS(RIGHT_BTN), AI_PRESS(LEFT_BTN) },                   // AI_MOVE_BACK
+    { AI_PRESS(PUNCH_BTN), AI_PRESS(PUNCH_BTN) },                  // AI_MOVE_PUNCH
+    { AI_PRESS(JUMP_BTN), AI_PRESS(JUMP_BTN) },                    // AI_MOVE_LOW_PUNCH
+    { AI_PRESS(DOWN_BTN) & AI_PRESS(JUMP_BTN),
+      AI_PRESS(DOWN_BTN) & AI_PRESS(JUMP_BTN) },                   // AI_MOVE_SQUAT_LOW_PUNCH
+    { AI_PRESS(TRI_BTN), AI_PRESS(TRI_BTN) },                      // AI_MOVE_BLOCK
+    { AI_PRESS(DOWN_BTN) & AI_PRESS(TRI_BTN),
+      AI_PRESS(DOWN_BTN) & AI_PRESS(TRI_BTN) },                    // AI_MOVE_SQUAT_BLOCK
+    { AI_PRESS(DOWN_BTN), AI_PRESS(DOWN_BTN) },                    // AI_MOVE_SQUAT
+};
+#undef AI_PRESS
+
+// Buttons for a move, given which side the opponent is on
+inline uint32_t aiMoveButtons(uint8_t move, bool moveRight) {
+    return aiMoveButtonTable[move][moveRight];
+}
+
+// What the opponent is doing, as far as the personalities care
+enum AIOpponentClass : uint8_t {
+    AI_OPP_NEUTRAL,       // Neither attacking nor hit
+    AI_OPP_HIT,           // In hit stagger
+    AI_OPP_ATTACK,        // Standing punch
+    AI_OPP_SQUAT_ATTACK,  // Squatting punch - blocked low
+    AI_OPP_CLASS_COUNT
+};
+
+inline uint8_t aiOpponentClass(const FighterView& opponent) {
+    if (opponent.flags & ANIM_ATTACK) {
+        return (opponent.flags & ANIM_SQUAT) ? AI_OPP_SQUAT_ATTACK : AI_OPP_ATTACK;
+    }
+    return opponent.isHit ? AI_OPP_HIT : AI_OPP_NEUTRAL;
+}
+
+// Compiled AI policy: what each personality does in each situation
+// The personalities below are written as behavior functions, but the game
+// runs them as lookup tables generated from those functions by
+// src/host/gen_policy.cpp. A situation is the personality, the opponent
+// class, whether the AI can punch and a distance bucket; it holds a few
+// weighted choices.
+struct PolicyChoice {
+    uint8_t move;            // AIMove
+    uint8_t weight;          // Percent - a cell's weights add up to 100
+    uint8_t duration;        // Ticks to hold the move...
+    uint8_t durationSpread;  // ...plus 0 to durationSpread - 1 more, at random
+};
+
+struct PolicyCell {
+    uint16_t first;  // Index of the cell's first choice in policy_choices
+    uint8_t count;
+};
+
+#include "ai_policy.h"
+#include "ai_neural.h"
+
+// Tunable numbers behind the heuristic personalities
+// X(name, min, max, personalities that use it, meaning) - distances are in
+// pixels between the fighters, chances in percent and holds in ticks. Each
+// personality's values are in ai_presets.h, and src/host/tune_ai.cpp evolves
+// them within these bounds. Distances stay within POLICY_MAX_DISTANCE so the
+// policy tables can hold every decision.
+#define AI_FOR(personality) (1 << AI_##personality)
+#define AI_PARAMS(X) \
+    X(punchRange,         10, 60,  AI_FOR(AGGRESSIVE) | AI_FOR(DEFENSIVE) | AI_FOR(BALANCED), "Close enough to punch") \
+    X(blockRange,         10, 80,  AI_FOR(DEFENSIVE) | AI_FOR(BALANCED),  "Block punches thrown from inside this") \
+    X(closeRange,         10, 90,  AI_FOR(AGGRESSIVE) | AI_FOR(BALANCED), "Close combat inside this") \
+    X(mediumRange,        20, 120, AI_FOR(AGGRESSIVE) | AI_FOR(BALANCED), "Advance steadily inside this, rush from further") \
+    X(retreatRange,       10, 90,  AI_FOR(DEFENSIVE),                     "Back away from an opponent inside this") \
+    X(advanceRange,       20, 120, AI_FOR(DEFENSIVE),                     "Walk toward an opponent beyond this") \
+    X(pokeRange,          10, 60,  AI_FOR(DEFENSIVE),                     "Poke at an opponent inside this") \
+    X(punishLowChance,    0,  100, AI_FOR(AGGRESSIVE) | AI_FOR(BALANCED), "Punish with a low punch rather than a high one") \
+    X(lowPunchChance,     0,  100, AI_FOR(AGGRESSIVE),                    "Attack with a low punch rather than a high one") \
+    X(closeAttackChance,  0,  100, AI_FOR(BALANCED),                      "Punch at close range rather than back off") \
+    X(mediumAttackChance, 0,  100, AI_FOR(BALANCED),                      "Punch at medium range rather than advance") \
+    X(pokeChance,         0,  100, AI_FOR(DEFENSIVE),                     "Poke when in range") \
+    X(shuffleChance,      0,  100, AI_FOR(DEFENSIVE),                     "Step back or forth rather than wait") \
+    X(punchHold,          1,  20,  AI_FOR(AGGRESSIVE) | AI_FOR(DEFENSIVE) | AI_FOR(BALANCED), "Punch, or punish") \
+    X(blockHold,          1,  20,  AI_FOR(DEFENSIVE) | AI_FOR(BALANCED),  "Block") \
+    X(closeHold,          1,  20,  AI_FOR(AGGRESSIVE),                    "Step in at close range") \
+    X(retreatHold,        1,  20,  AI_FOR(DEFENSIVE) | AI_FOR(BALANCED),  "Back away") \
+    X(mediumHold,         1,  20,  AI_FOR(AGGRESSIVE) | AI_FOR(BALANCED), "Advance at medium range") \
+    X(farHold,            1,  20,  AI_FOR(AGGRESSIVE) | AI_FOR(DEFENSIVE) | AI_FOR(BALANCED), "Advance from far away") \
+    X(pokeHold,           1,  20,  AI_FOR(DEFENSIVE),                     "Poke") \
+    X(shuffleHold,        1,  20,  AI_FOR(DEFENSIVE),                     "Step back or forth") \
+    X(idleHold,           1,  20,  AI_FOR(DEFENSIVE),                     "Wait") \
+    X(randomHold,         1,  20,  AI_FOR(RANDOM),                        "Any random action...") \
+    X(randomHoldSpread,   1,  20,  AI_FOR(RANDOM),                        "...plus 0 to this - 1 more")
+
+#define AI_PARAM_FIELD(name, min, max, users, meaning) int name;
+struct AIParams {
+    AI_PARAMS(AI_PARAM_FIELD)
+};
+#undef AI_PARAM_FIELD
+
+#define AI_PRESET_COUNT 4  // AI_AGGRESSIVE to AI_RANDOM
+
+#include "ai_presets.h"
+
+// The numbers a heuristic personality plays by
+inline const AIParams& aiParams(const AIController* ai) {
+    return ai->params ? *ai->params : ai_presets[ai->personality];
+}
 
 // Helper function: Get distance to opponent
 int getDistanceToOpponent(AIController* ai) {
-    if (!ai->self || !ai->opponent) return 1000;  // Large distance if invalid
-    return abs(ai->self->xPos - ai->opponent->xPos);
+    if (!ai->self || !ai->opponent || !ai->observation) return 1000;  // Large distance if invalid
+    return ai->observation->distance;
 }
 
 // Helper function: Check if opponent is attacking
 bool isOpponentAttacking(AIController* ai) {
     if (!ai->opponent) return false;
 
-    int anim = ai->opponent->animation;
-    return (anim == ANIMATION_PUNCHING_HIGH ||
-            anim == ANIMATION_PUNCHING_LOW ||
-            anim == ANIMATION_SQUATPUNCHING_HIGH ||
-            anim == ANIMATION_SQUATPUNCHING_LOW);
+    return (aiOpponent(ai).flags & ANIM_ATTACK) != 0;
 }
 
 // Helper function: Check if we're in range to punch
 bool isInPunchRange(AIController* ai, int distance) {
-    return distance <= PUNCH_RANGE && ai->self->canPunch;
+    return distance <= aiParams(ai).punchRange && aiSelf(ai).canPunch;
 }
 
 // Helper function: Check if opponent is vulnerable (hit stagger or mid-animation)
 bool isOpponentVulnerable(AIController* ai) {
     if (!ai->opponent) return false;
-    return ai->opponent->isHit || isOpponentAttacking(ai);
+    return aiOpponent(ai).isHit || isOpponentAttacking(ai);
 }
 
 // Helper function: Should we block right now?
 bool shouldBlock(AIController* ai, int distance) {
     // Block if opponent is attacking and close enough to hit us
-    return isOpponentAttacking(ai) && distance <= PUNCH_RANGE + 10;
+    return isOpponentAttacking(ai) && distance <= aiParams(ai).blockRange;
 }
 
 // Initialize AI for a player
-void initAI(AIController* ai, Player* self, Player* opponent, AIPersonality personality) {
+void initAI(AIController* ai, Player* self, Player* opponent, const Observation* observation,
+            AIPersonality personality, uint32_t seed) {
     ai->enabled = false;
     ai->personality = personality;
     ai->self = self;
     ai->opponent = opponent;
+    ai->observation = observation;
     ai->decisionTimer = 0;
     ai->currentAction = 0xFFFFFFFF;  // No buttons pressed
     ai->actionDuration = 0;
+    ai->debugCounter = 0;
+    ai->balancedDebugCounter = 0;
+    clearAIPlan(ai);
+    ai->net = &neural_net;
+    ai->params = nullptr;
+    aiSeedRandom(ai, seed);
 }
 
 // Aggressive AI: Rushdown style - constantly pressures, attacks in range
 uint32_t ai_aggressive_behavior(AIController* ai, int distance, int* duration) {
-    bool moveRight = (ai->opponent->xPos > ai->self->xPos);
+    const AIParams& p = aiParams(ai);
+    bool moveRight = aiOpponentOnRight(ai);
 
     // PRIORITY 1: Opponent is vulnerable (hit or attacking) and we're in range - PUNISH!
     if (isOpponentVulnerable(ai) && isInPunchRange(ai, distance)) {
-        *duration = 6;
+        *duration = p.punchHold;
         // Mix high and low punches for variety
-        bool useLowPunch = (rand() % 100 < 40);
+        bool useLowPunch = (aiRandom(ai) % 100 < p.punishLowChance);
         if (useLowPunch) {
             return createButtonState(false, true, false, false,
                                     false, true, false);  // Squat low punch
@@ -134,8 +313,8 @@ uint32_t ai_aggressive_behavior(AIController* ai, int distance, int* duration) {
 
     // PRIORITY 2: In punch range - ATTACK! (even if opponent isn't vulnerable)
     if (isInPunchRange(ai, distance)) {
-        *duration = 6;
-        bool useLowPunch = (rand() % 100 < 30);  // 30% low, 70% high
+        *duration = p.punchHold;
+        bool useLowPunch = (aiRandom(ai) % 100 < p.lowPunchChance);
         if (useLowPunch) {
             return createButtonState(false, true, false, false,
                                     false, true, false);
@@ -146,74 +325,74 @@ uint32_t ai_aggressive_behavior(AIController* ai, int distance, int* duration) {
     }
 
     // PRIORITY 3: Close but not quite in range - move forward to close gap
-    if (distance < CLOSE_RANGE) {
-        *duration = 4;  // Short duration for quick adjustments
+    if (distance < p.closeRange) {
+        *duration = p.closeHold;  // Short duration for quick adjustments
         return createButtonState(false, false, !moveRight, moveRight,
                                 false, false, false);
     }
 
     // PRIORITY 4: Medium range - advance steadily
-    if (distance < MEDIUM_RANGE) {
-        *duration = 8;
+    if (distance < p.mediumRange) {
+        *duration = p.mediumHold;
         return createButtonState(false, false, !moveRight, moveRight,
                                 false, false, false);
     }
 
     // PRIORITY 5: Far range - rush in quickly
-    *duration = 10;
+    *duration = p.farHold;
     return createButtonState(false, false, !moveRight, moveRight,
                             false, false, false);
 }
 
 // Defensive AI: Patient, blocks well, waits for opportunities to counterattack
 uint32_t ai_defensive_behavior(AIController* ai, int distance, int* duration) {
-    bool moveRight = (ai->opponent->xPos > ai->self->xPos);
+    const AIParams& p = aiParams(ai);
+    bool moveRight = aiOpponentOnRight(ai);
 
     // PRIORITY 1: Opponent is attacking and in range - BLOCK!
     if (shouldBlock(ai, distance)) {
-        *duration = 12;  // Hold block longer for safety
-        bool isSquatPunch = (ai->opponent->animation == ANIMATION_SQUATPUNCHING_LOW ||
-                            ai->opponent->animation == ANIMATION_SQUATPUNCHING_HIGH);
+        *duration = p.blockHold;  // Hold block longer for safety
+        bool isSquatPunch = (aiOpponent(ai).flags & ANIM_SQUAT) != 0;
         return createButtonState(false, isSquatPunch, false, false,
                                 false, false, true);  // Block (squat if needed)
     }
 
     // PRIORITY 2: Opponent is vulnerable and we're in perfect range - COUNTERATTACK!
-    if (ai->opponent->isHit && isInPunchRange(ai, distance)) {
-        *duration = 6;
+    if (aiOpponent(ai).isHit && isInPunchRange(ai, distance)) {
+        *duration = p.punchHold;
         return createButtonState(false, false, false, false,
                                 true, false, false);  // Quick counter punch
     }
 
     // PRIORITY 3: Too close to opponent - back away to safe distance
-    bool tooClose = (distance < SAFE_DEFENSIVE_RANGE - 10);
+    bool tooClose = (distance < p.retreatRange);
     if (tooClose) {
-        *duration = 6;
+        *duration = p.retreatHold;
         return createButtonState(false, false, moveRight, !moveRight,
                                 false, false, false);  // Retreat
     }
 
     // PRIORITY 4: Too far from opponent - advance to safe distance
-    bool tooFar = (distance > SAFE_DEFENSIVE_RANGE + 15);
+    bool tooFar = (distance > p.advanceRange);
     if (tooFar) {
-        *duration = 6;
+        *duration = p.farHold;
         return createButtonState(false, false, !moveRight, moveRight,
                                 false, false, false);  // Advance cautiously
     }
 
     // PRIORITY 5: At safe distance - occasional poke or slight adjustments
     // Defensive AI should still be active, not just stand still
-    if (distance < PUNCH_RANGE + 5 && ai->self->canPunch && rand() % 100 < 20) {
-        *duration = 5;
+    if (distance < p.pokeRange && aiSelf(ai).canPunch && aiRandom(ai) % 100 < p.pokeChance) {
+        *duration = p.pokeHold;
         return createButtonState(false, false, false, false,
                                 true, false, false);  // Occasional poke
     }
 
     // At safe distance but not in poke range - make small movements for positioning
-    if (rand() % 100 < 30) {
-        *duration = 5;
+    if (aiRandom(ai) % 100 < p.shuffleChance) {
+        *duration = p.shuffleHold;
         // 50/50 move closer or back up slightly
-        bool moveForward = (rand() % 2 == 0);
+        bool moveForward = (aiRandom(ai) % 2 == 0);
         if (moveForward) {
             return createButtonState(false, false, !moveRight, moveRight,
                                     false, false, false);
@@ -224,37 +403,36 @@ uint32_t ai_defensive_behavior(AIController* ai, int distance, int* duration) {
     }
 
     // Default: Stay alert at safe distance
-    *duration = 4;  // Short duration to react quickly
+    *duration = p.idleHold;  // Short duration to react quickly
     return 0xFFFFFFFF;  // Idle, ready to react
 }
 
 // Balanced AI: Adaptable fighter - blocks threats, punishes mistakes, controls space
 uint32_t ai_balanced_behavior(AIController* ai, int distance, int* duration) {
-    bool moveRight = (ai->opponent->xPos > ai->self->xPos);
+    const AIParams& p = aiParams(ai);
+    bool moveRight = aiOpponentOnRight(ai);
 
     // Debug
-    static int balancedDebugCounter = 0;
-    bool shouldDebug = (balancedDebugCounter++ % 60 == 0);
+    bool shouldDebug = (ai->balancedDebugCounter++ % 60 == 0);
     if (shouldDebug) {
-        Serial.printf("  BALANCED: dist=%d, moveRight=%d\n", distance, moveRight);
+        LOG_EVENT(EV_AI_BALANCED, distance, moveRight);
     }
 
     // PRIORITY 1: Opponent attacking close - BLOCK!
     if (shouldBlock(ai, distance)) {
-        if (shouldDebug) Serial.println("    -> BLOCK");
+        if (shouldDebug) LOG_EVENT(EV_AI_BLOCK);
 
-        *duration = 10;
-        bool isSquatPunch = (ai->opponent->animation == ANIMATION_SQUATPUNCHING_LOW ||
-                            ai->opponent->animation == ANIMATION_SQUATPUNCHING_HIGH);
+        *duration = p.blockHold;
+        bool isSquatPunch = (aiOpponent(ai).flags & ANIM_SQUAT) != 0;
         return createButtonState(false, isSquatPunch, false, false,
                                 false, false, true);
     }
 
     // PRIORITY 2: Opponent vulnerable and in range - PUNISH!
     if (isOpponentVulnerable(ai) && isInPunchRange(ai, distance)) {
-        if (shouldDebug) Serial.println("    -> PUNISH");
-        *duration = 6;
-        bool useLowPunch = (rand() % 100 < 35);
+        if (shouldDebug) LOG_EVENT(EV_AI_PUNISH);
+        *duration = p.punchHold;
+        bool useLowPunch = (aiRandom(ai) % 100 < p.punishLowChance);
         if (useLowPunch) {
             return createButtonState(false, true, false, false,
                                     false, true, false);
@@ -265,51 +443,52 @@ uint32_t ai_balanced_behavior(AIController* ai, int distance, int* duration) {
     }
 
     // PRIORITY 3: Very close range - smart decision based on situation
-    if (distance < CLOSE_RANGE) {
-        if (shouldDebug) Serial.println("    -> CLOSE RANGE");
-        // If we can punch and opponent not blocking, 60% attack
-        if (isInPunchRange(ai, distance) && rand() % 100 < 60) {
-            *duration = 6;
+    if (distance < p.closeRange) {
+        if (shouldDebug) LOG_EVENT(EV_AI_CLOSE_RANGE);
+        // If we can punch and opponent not blocking, sometimes attack
+        if (isInPunchRange(ai, distance) && aiRandom(ai) % 100 < p.closeAttackChance) {
+            *duration = p.punchHold;
             return createButtonState(false, false, false, false,
                                     true, false, false);
         } else {
             // Otherwise back up a bit for spacing
-            *duration = 5;
+            *duration = p.retreatHold;
             return createButtonState(false, false, moveRight, !moveRight,
                                     false, false, false);
         }
     }
 
     // PRIORITY 4: Medium range - advance with occasional attacks
-    if (distance < MEDIUM_RANGE) {
-        if (shouldDebug) Serial.printf("    -> MEDIUM RANGE (dist=%d < %d)\n", distance, MEDIUM_RANGE);
-        // 35% chance to attack if in range
-        if (isInPunchRange(ai, distance) && rand() % 100 < 35) {
-            *duration = 6;
+    if (distance < p.mediumRange) {
+        if (shouldDebug) LOG_EVENT(EV_AI_MEDIUM, distance, p.mediumRange);
+        // Some chance to attack if in range
+        if (isInPunchRange(ai, distance) && aiRandom(ai) % 100 < p.mediumAttackChance) {
+            *duration = p.punchHold;
             return createButtonState(false, false, false, false,
                                     true, false, false);
         } else {
-            if (shouldDebug) Serial.printf("    -> ADVANCING (moveRight=%d)\n", moveRight);
+            if (shouldDebug) LOG_EVENT(EV_AI_ADVANCING, moveRight);
             // Move forward
-            *duration = 7;
+            *duration = p.mediumHold;
             return createButtonState(false, false, !moveRight, moveRight,
                                     false, false, false);
         }
     }
 
     // PRIORITY 5: Far range - close the distance
-    if (shouldDebug) Serial.println("    -> FAR RANGE");
-    *duration = 8;
+    if (shouldDebug) LOG_EVENT(EV_AI_FAR_RANGE);
+    *duration = p.farHold;
     return createButtonState(false, false, !moveRight, moveRight,
                             false, false, false);
 }
 
 // Random AI: Beginner level, random actions
 uint32_t ai_random_behavior(AIController* ai, int* duration) {
-    int action = rand() % 10;
-    *duration = 5 + (rand() % 10);  // 5-15 frames
+    const AIParams& p = aiParams(ai);
+    int action = aiRandom(ai) % 10;
+    *duration = p.randomHold + (aiRandom(ai) % p.randomHoldSpread);
 
-    bool moveRight = (ai->opponent->xPos > ai->self->xPos);
+    bool moveRight = aiOpponentOnRight(ai);
 
     switch (action) {
         case 0:  // Move toward opponent
@@ -319,13 +498,13 @@ uint32_t ai_random_behavior(AIController* ai, int* duration) {
             return createButtonState(false, false, moveRight, !moveRight,
                                     false, false, false);
         case 2:  // Punch
-            if (ai->self->canPunch) {
+            if (aiSelf(ai).canPunch) {
                 return createButtonState(false, false, false, false,
                                         true, false, false);
             }
             break;
         case 3:  // Low punch
-            if (ai->self->canPunch) {
+            if (aiSelf(ai).canPunch) {
                 return createButtonState(false, false, false, false,
                                         false, true, false);
             }
@@ -343,20 +522,81 @@ uint32_t ai_random_behavior(AIController* ai, int* duration) {
     return 0xFFFFFFFF;  // Idle
 }
 
+// The behavior functions behind a personality's policy table
+// The game reads the tables; this runs only to build them (src/host/gen_policy.cpp)
+// and for candidates being tuned (src/host/tune_ai.cpp).
+uint32_t ai_heuristic_behavior(AIController* ai, int distance, int* duration) {
+    switch (ai->personality) {
+        case AI_AGGRESSIVE:
+            return ai_aggressive_behavior(ai, distance, duration);
+        case AI_DEFENSIVE:
+            return ai_defensive_behavior(ai, distance, duration);
+        case AI_BALANCED:
+            return ai_balanced_behavior(ai, distance, duration);
+        case AI_RANDOM:
+            return ai_random_behavior(ai, duration);
+        default:
+            *duration = 5;
+            return 0xFFFFFFFF;  // Idle
+    }
+}
+
+// Pick a move from a personality's policy table: one lookup, then a weighted
+// pick that draws from the RNG only when the cell has a choice to make
+uint32_t ai_policy_behavior(AIController* ai, AIPersonality personality, int distance, int* duration) {
+    if (distance > POLICY_MAX_DISTANCE) distance = POLICY_MAX_DISTANCE;
+
+    const PolicyCell& cell = policy_cells[personality][aiOpponentClass(aiOpponent(ai))]
+                                         [aiSelf(ai).canPunch][policy_distance_bucket[distance]];
+    const PolicyChoice* choice = &policy_choices[cell.first];
+    if (cell.count > 1) {
+        int roll = aiRandom(ai) % 100;
+        while (roll >= choice->weight) {
+            roll -= choice->weight;
+            choice++;
+        }
+    }
+
+    *duration = choice->duration;
+    if (choice->durationSpread > 1) {
+        *duration += aiRandom(ai) % choice->durationSpread;
+    }
+    return aiMoveButtons(choice->move, aiOpponentOnRight(ai));
+}
+
+// Expert AI: plays the move the lookahead search left in plannedAction
+// The search (ai_expert.h) runs between ticks; when it did not finish in its
+// budget there is no plan and the balanced policy decides instead.
+uint32_t ai_expert_behavior(AIController* ai, int distance, int* duration) {
+    if (ai->plannedDuration > 0) {
+        *duration = ai->plannedDuration - 1;  // This tick counts too
+        ai->plannedDuration = 0;              // Each plan is played once
+        return ai->plannedAction;
+    }
+    return ai_policy_behavior(ai, AI_BALANCED, distance, duration);
+}
+
+// Neural AI: one pass of the policy network per decision (ai_neural.h)
+uint32_t ai_neural_behavior(AIController* ai, int* duration) {
+    int8_t inputs[NEURAL_WIDTH];
+    neuralObserve(*ai->observation, ai->self, ai->opponent, inputs);
+    uint8_t move = neuralDecide(*ai->net, inputs);
+
+    *duration = NEURAL_HOLD_TICKS - 1;  // This tick counts too
+    return aiMoveButtons(move, aiOpponentOnRight(ai));
+}
+
 // Main AI decision function - called every frame when AI is enabled
 uint32_t ai_make_decision(AIController* ai) {
     // Validate AI controller
-    if (!ai || !ai->self || !ai->opponent) {
-        Serial.println("AI: Invalid controller/player pointers");
+    if (!ai || !ai->self || !ai->opponent || !ai->observation) {
         return 0xFFFFFFFF;  // Return idle state if invalid
     }
 
     // Debug: Log every 60 frames (~2.4 seconds at 25fps)
-    static int debugCounter = 0;
-    if (debugCounter++ % 60 == 0) {
-        Serial.printf("AI P%d: enabled=%d, dist=%d, action=0x%08X, dur=%d\n",
-                     ai->self->playerNumber, ai->enabled,
-                     getDistanceToOpponent(ai), ai->currentAction, ai->actionDuration);
+    if (ai->debugCounter++ % 60 == 0) {
+        LOG_EVENT(EV_AI_STATUS, ai->self->playerNumber, getDistanceToOpponent(ai),
+                  ai->currentAction, ai->actionDuration);
     }
 
     // If currently holding an action, continue holding it until duration expires
@@ -375,16 +615,20 @@ uint32_t ai_make_decision(AIController* ai) {
 
     switch (ai->personality) {
         case AI_AGGRESSIVE:
-            newAction = ai_aggressive_behavior(ai, distance, &duration);
-            break;
         case AI_DEFENSIVE:
-            newAction = ai_defensive_behavior(ai, distance, &duration);
-            break;
         case AI_BALANCED:
-            newAction = ai_balanced_behavior(ai, distance, &duration);
-            break;
         case AI_RANDOM:
-            newAction = ai_random_behavior(ai, &duration);
+            if (ai->params) {
+                newAction = ai_heuristic_behavior(ai, distance, &duration);  // Candidate being tuned
+            } else {
+                newAction = ai_policy_behavior(ai, ai->personality, distance, &duration);
+            }
+            break;
+        case AI_EXPERT:
+            newAction = ai_expert_behavior(ai, distance, &duration);
+            break;
+        case AI_NEURAL:
+            newAction = ai_neural_behavior(ai, &duration);
             break;
         default:
             newAction = 0xFFFFFFFF;  // Idle
@@ -397,9 +641,8 @@ uint32_t ai_make_decision(AIController* ai) {
     ai->actionDuration = duration;
 
     // Debug: Log the new decision
-    if (debugCounter % 60 == 1) {  // Log right after the previous debug
-        Serial.printf("  -> NEW decision: action=0x%08X, dur=%d, personality=%d\n",
-                     newAction, duration, ai->personality);
+    if (ai->debugCounter % 60 == 1) {  // Log right after the previous debug
+        LOG_EVENT(EV_AI_DECISION, newAction, duration, ai->personality);
     }
 
     return newAction;
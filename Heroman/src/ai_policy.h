@@ -0,0 +1,871 @@
+#pragma once
+
+#include <stdint.h>
+#include <pgmspace.h>
+
+// Generated by  : src/host/gen_policy.cpp - do not edit by hand
+// Source        : the behavior functions in ai_player.h, 1000000 seeds per situation
+//
+// AI decision tables, indexed by personality, opponent class
+// (aiOpponentClass()), canPunch and distance bucket. Each cell lists its
+// moves, most likely first, with their odds in percent and hold times.
+
+#define POLICY_PERSONALITIES 4
+#define POLICY_DISTANCE_BUCKETS 7
+#define POLICY_MAX_DISTANCE 127  // Further away decides like this
+
+// Buckets: 0-35, 36-39, 40-44, 45-45, 46-65, 66-69, 70-127
+constexpr uint8_t policy_distance_bucket[POLICY_MAX_DISTANCE + 1] PROGMEM = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+};
+
+constexpr PolicyChoice policy_choices[542] PROGMEM = {
+    // AGGRESSIVE, opponent neutral, can't punch, distance 0-35
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent neutral, can't punch, distance 36-39
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent neutral, can't punch, distance 40-44
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent neutral, can't punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent neutral, can't punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent neutral, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent neutral, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 10, 1 },
+    // AGGRESSIVE, opponent neutral, can punch, distance 0-35
+    { AI_MOVE_PUNCH, 70, 6, 1 },
+    { AI_MOVE_SQUAT_LOW_PUNCH, 30, 6, 1 },
+    // AGGRESSIVE, opponent neutral, can punch, distance 36-39
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent neutral, can punch, distance 40-44
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent neutral, can punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent neutral, can punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent neutral, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent neutral, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 10, 1 },
+    // AGGRESSIVE, opponent hit, can't punch, distance 0-35
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent hit, can't punch, distance 36-39
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent hit, can't punch, distance 40-44
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent hit, can't punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent hit, can't punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent hit, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent hit, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 10, 1 },
+    // AGGRESSIVE, opponent hit, can punch, distance 0-35
+    { AI_MOVE_PUNCH, 60, 6, 1 },
+    { AI_MOVE_SQUAT_LOW_PUNCH, 40, 6, 1 },
+    // AGGRESSIVE, opponent hit, can punch, distance 36-39
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent hit, can punch, distance 40-44
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent hit, can punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent hit, can punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent hit, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent hit, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 10, 1 },
+    // AGGRESSIVE, opponent attacking, can't punch, distance 0-35
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent attacking, can't punch, distance 36-39
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent attacking, can't punch, distance 40-44
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent attacking, can't punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent attacking, can't punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent attacking, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent attacking, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 10, 1 },
+    // AGGRESSIVE, opponent attacking, can punch, distance 0-35
+    { AI_MOVE_PUNCH, 60, 6, 1 },
+    { AI_MOVE_SQUAT_LOW_PUNCH, 40, 6, 1 },
+    // AGGRESSIVE, opponent attacking, can punch, distance 36-39
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent attacking, can punch, distance 40-44
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent attacking, can punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent attacking, can punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent attacking, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent attacking, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 10, 1 },
+    // AGGRESSIVE, opponent squat attacking, can't punch, distance 0-35
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent squat attacking, can't punch, distance 36-39
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent squat attacking, can't punch, distance 40-44
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent squat attacking, can't punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent squat attacking, can't punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent squat attacking, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent squat attacking, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 10, 1 },
+    // AGGRESSIVE, opponent squat attacking, can punch, distance 0-35
+    { AI_MOVE_PUNCH, 60, 6, 1 },
+    { AI_MOVE_SQUAT_LOW_PUNCH, 40, 6, 1 },
+    // AGGRESSIVE, opponent squat attacking, can punch, distance 36-39
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent squat attacking, can punch, distance 40-44
+    { AI_MOVE_FORWARD, 100, 4, 1 },
+    // AGGRESSIVE, opponent squat attacking, can punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent squat attacking, can punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent squat attacking, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // AGGRESSIVE, opponent squat attacking, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 10, 1 },
+    // DEFENSIVE, opponent neutral, can't punch, distance 0-35
+    { AI_MOVE_BACK, 100, 6, 1 },
+    // DEFENSIVE, opponent neutral, can't punch, distance 36-39
+    { AI_MOVE_BACK, 100, 6, 1 },
+    // DEFENSIVE, opponent neutral, can't punch, distance 40-44
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent neutral, can't punch, distance 45-45
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent neutral, can't punch, distance 46-65
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent neutral, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent neutral, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent neutral, can punch, distance 0-35
+    { AI_MOVE_BACK, 100, 6, 1 },
+    // DEFENSIVE, opponent neutral, can punch, distance 36-39
+    { AI_MOVE_BACK, 100, 6, 1 },
+    // DEFENSIVE, opponent neutral, can punch, distance 40-44
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent neutral, can punch, distance 45-45
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent neutral, can punch, distance 46-65
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent neutral, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent neutral, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent hit, can't punch, distance 0-35
+    { AI_MOVE_BACK, 100, 6, 1 },
+    // DEFENSIVE, opponent hit, can't punch, distance 36-39
+    { AI_MOVE_BACK, 100, 6, 1 },
+    // DEFENSIVE, opponent hit, can't punch, distance 40-44
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent hit, can't punch, distance 45-45
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent hit, can't punch, distance 46-65
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent hit, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent hit, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent hit, can punch, distance 0-35
+    { AI_MOVE_PUNCH, 100, 6, 1 },
+    // DEFENSIVE, opponent hit, can punch, distance 36-39
+    { AI_MOVE_BACK, 100, 6, 1 },
+    // DEFENSIVE, opponent hit, can punch, distance 40-44
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent hit, can punch, distance 45-45
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent hit, can punch, distance 46-65
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent hit, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent hit, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent attacking, can't punch, distance 0-35
+    { AI_MOVE_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent attacking, can't punch, distance 36-39
+    { AI_MOVE_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent attacking, can't punch, distance 40-44
+    { AI_MOVE_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent attacking, can't punch, distance 45-45
+    { AI_MOVE_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent attacking, can't punch, distance 46-65
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent attacking, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent attacking, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent attacking, can punch, distance 0-35
+    { AI_MOVE_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent attacking, can punch, distance 36-39
+    { AI_MOVE_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent attacking, can punch, distance 40-44
+    { AI_MOVE_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent attacking, can punch, distance 45-45
+    { AI_MOVE_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent attacking, can punch, distance 46-65
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent attacking, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent attacking, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent squat attacking, can't punch, distance 0-35
+    { AI_MOVE_SQUAT_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent squat attacking, can't punch, distance 36-39
+    { AI_MOVE_SQUAT_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent squat attacking, can't punch, distance 40-44
+    { AI_MOVE_SQUAT_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent squat attacking, can't punch, distance 45-45
+    { AI_MOVE_SQUAT_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent squat attacking, can't punch, distance 46-65
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent squat attacking, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent squat attacking, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent squat attacking, can punch, distance 0-35
+    { AI_MOVE_SQUAT_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent squat attacking, can punch, distance 36-39
+    { AI_MOVE_SQUAT_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent squat attacking, can punch, distance 40-44
+    { AI_MOVE_SQUAT_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent squat attacking, can punch, distance 45-45
+    { AI_MOVE_SQUAT_BLOCK, 100, 12, 1 },
+    // DEFENSIVE, opponent squat attacking, can punch, distance 46-65
+    { AI_MOVE_IDLE, 70, 4, 1 },
+    { AI_MOVE_FORWARD, 15, 5, 1 },
+    { AI_MOVE_BACK, 15, 5, 1 },
+    // DEFENSIVE, opponent squat attacking, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // DEFENSIVE, opponent squat attacking, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 6, 1 },
+    // BALANCED, opponent neutral, can't punch, distance 0-35
+    { AI_MOVE_BACK, 100, 5, 1 },
+    // BALANCED, opponent neutral, can't punch, distance 36-39
+    { AI_MOVE_BACK, 100, 5, 1 },
+    // BALANCED, opponent neutral, can't punch, distance 40-44
+    { AI_MOVE_BACK, 100, 5, 1 },
+    // BALANCED, opponent neutral, can't punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent neutral, can't punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent neutral, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent neutral, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // BALANCED, opponent neutral, can punch, distance 0-35
+    { AI_MOVE_PUNCH, 60, 6, 1 },
+    { AI_MOVE_BACK, 40, 5, 1 },
+    // BALANCED, opponent neutral, can punch, distance 36-39
+    { AI_MOVE_BACK, 100, 5, 1 },
+    // BALANCED, opponent neutral, can punch, distance 40-44
+    { AI_MOVE_BACK, 100, 5, 1 },
+    // BALANCED, opponent neutral, can punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent neutral, can punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent neutral, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent neutral, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // BALANCED, opponent hit, can't punch, distance 0-35
+    { AI_MOVE_BACK, 100, 5, 1 },
+    // BALANCED, opponent hit, can't punch, distance 36-39
+    { AI_MOVE_BACK, 100, 5, 1 },
+    // BALANCED, opponent hit, can't punch, distance 40-44
+    { AI_MOVE_BACK, 100, 5, 1 },
+    // BALANCED, opponent hit, can't punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent hit, can't punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent hit, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent hit, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // BALANCED, opponent hit, can punch, distance 0-35
+    { AI_MOVE_PUNCH, 65, 6, 1 },
+    { AI_MOVE_SQUAT_LOW_PUNCH, 35, 6, 1 },
+    // BALANCED, opponent hit, can punch, distance 36-39
+    { AI_MOVE_BACK, 100, 5, 1 },
+    // BALANCED, opponent hit, can punch, distance 40-44
+    { AI_MOVE_BACK, 100, 5, 1 },
+    // BALANCED, opponent hit, can punch, distance 45-45
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent hit, can punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent hit, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent hit, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // BALANCED, opponent attacking, can't punch, distance 0-35
+    { AI_MOVE_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent attacking, can't punch, distance 36-39
+    { AI_MOVE_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent attacking, can't punch, distance 40-44
+    { AI_MOVE_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent attacking, can't punch, distance 45-45
+    { AI_MOVE_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent attacking, can't punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent attacking, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent attacking, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // BALANCED, opponent attacking, can punch, distance 0-35
+    { AI_MOVE_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent attacking, can punch, distance 36-39
+    { AI_MOVE_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent attacking, can punch, distance 40-44
+    { AI_MOVE_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent attacking, can punch, distance 45-45
+    { AI_MOVE_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent attacking, can punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent attacking, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent attacking, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // BALANCED, opponent squat attacking, can't punch, distance 0-35
+    { AI_MOVE_SQUAT_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent squat attacking, can't punch, distance 36-39
+    { AI_MOVE_SQUAT_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent squat attacking, can't punch, distance 40-44
+    { AI_MOVE_SQUAT_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent squat attacking, can't punch, distance 45-45
+    { AI_MOVE_SQUAT_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent squat attacking, can't punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent squat attacking, can't punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent squat attacking, can't punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // BALANCED, opponent squat attacking, can punch, distance 0-35
+    { AI_MOVE_SQUAT_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent squat attacking, can punch, distance 36-39
+    { AI_MOVE_SQUAT_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent squat attacking, can punch, distance 40-44
+    { AI_MOVE_SQUAT_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent squat attacking, can punch, distance 45-45
+    { AI_MOVE_SQUAT_BLOCK, 100, 10, 1 },
+    // BALANCED, opponent squat attacking, can punch, distance 46-65
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent squat attacking, can punch, distance 66-69
+    { AI_MOVE_FORWARD, 100, 7, 1 },
+    // BALANCED, opponent squat attacking, can punch, distance 70-127
+    { AI_MOVE_FORWARD, 100, 8, 1 },
+    // RANDOM, opponent neutral, can't punch, distance 0-35
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can't punch, distance 36-39
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can't punch, distance 40-44
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can't punch, distance 45-45
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can't punch, distance 46-65
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can't punch, distance 66-69
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can't punch, distance 70-127
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can punch, distance 0-35
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can punch, distance 36-39
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can punch, distance 40-44
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can punch, distance 45-45
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can punch, distance 46-65
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can punch, distance 66-69
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent neutral, can punch, distance 70-127
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can't punch, distance 0-35
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can't punch, distance 36-39
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can't punch, distance 40-44
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can't punch, distance 45-45
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can't punch, distance 46-65
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can't punch, distance 66-69
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can't punch, distance 70-127
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can punch, distance 0-35
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can punch, distance 36-39
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can punch, distance 40-44
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can punch, distance 45-45
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can punch, distance 46-65
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can punch, distance 66-69
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent hit, can punch, distance 70-127
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can't punch, distance 0-35
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can't punch, distance 36-39
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can't punch, distance 40-44
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can't punch, distance 45-45
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can't punch, distance 46-65
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can't punch, distance 66-69
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can't punch, distance 70-127
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can punch, distance 0-35
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can punch, distance 36-39
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can punch, distance 40-44
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can punch, distance 45-45
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can punch, distance 46-65
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can punch, distance 66-69
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent attacking, can punch, distance 70-127
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can't punch, distance 0-35
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can't punch, distance 36-39
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can't punch, distance 40-44
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can't punch, distance 45-45
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can't punch, distance 46-65
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can't punch, distance 66-69
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can't punch, distance 70-127
+    { AI_MOVE_IDLE, 60, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can punch, distance 0-35
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can punch, distance 36-39
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can punch, distance 40-44
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can punch, distance 45-45
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can punch, distance 46-65
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can punch, distance 66-69
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+    // RANDOM, opponent squat attacking, can punch, distance 70-127
+    { AI_MOVE_IDLE, 40, 5, 10 },
+    { AI_MOVE_FORWARD, 10, 5, 10 },
+    { AI_MOVE_BACK, 10, 5, 10 },
+    { AI_MOVE_PUNCH, 10, 5, 10 },
+    { AI_MOVE_LOW_PUNCH, 10, 5, 10 },
+    { AI_MOVE_BLOCK, 10, 5, 10 },
+    { AI_MOVE_SQUAT, 10, 5, 10 },
+};
+
+constexpr PolicyCell policy_cells[POLICY_PERSONALITIES][4][2][POLICY_DISTANCE_BUCKETS] PROGMEM = {
+    {  // AGGRESSIVE
+        {  // Opponent neutral
+            { { 0, 1 }, { 1, 1 }, { 2, 1 }, { 3, 1 }, { 4, 1 }, { 5, 1 }, { 6, 1 } },  // Can't punch
+            { { 7, 2 }, { 9, 1 }, { 10, 1 }, { 11, 1 }, { 12, 1 }, { 13, 1 }, { 14, 1 } },
+        },
+        {  // Opponent hit
+            { { 15, 1 }, { 16, 1 }, { 17, 1 }, { 18, 1 }, { 19, 1 }, { 20, 1 }, { 21, 1 } },  // Can't punch
+            { { 22, 2 }, { 24, 1 }, { 25, 1 }, { 26, 1 }, { 27, 1 }, { 28, 1 }, { 29, 1 } },
+        },
+        {  // Opponent attacking
+            { { 30, 1 }, { 31, 1 }, { 32, 1 }, { 33, 1 }, { 34, 1 }, { 35, 1 }, { 36, 1 } },  // Can't punch
+            { { 37, 2 }, { 39, 1 }, { 40, 1 }, { 41, 1 }, { 42, 1 }, { 43, 1 }, { 44, 1 } },
+        },
+        {  // Opponent squat attacking
+            { { 45, 1 }, { 46, 1 }, { 47, 1 }, { 48, 1 }, { 49, 1 }, { 50, 1 }, { 51, 1 } },  // Can't punch
+            { { 52, 2 }, { 54, 1 }, { 55, 1 }, { 56, 1 }, { 57, 1 }, { 58, 1 }, { 59, 1 } },
+        },
+    },
+    {  // DEFENSIVE
+        {  // Opponent neutral
+            { { 60, 1 }, { 61, 1 }, { 62, 3 }, { 65, 3 }, { 68, 3 }, { 71, 1 }, { 72, 1 } },  // Can't punch
+            { { 73, 1 }, { 74, 1 }, { 75, 3 }, { 78, 3 }, { 81, 3 }, { 84, 1 }, { 85, 1 } },
+        },
+        {  // Opponent hit
+            { { 86, 1 }, { 87, 1 }, { 88, 3 }, { 91, 3 }, { 94, 3 }, { 97, 1 }, { 98, 1 } },  // Can't punch
+            { { 99, 1 }, { 100, 1 }, { 101, 3 }, { 104, 3 }, { 107, 3 }, { 110, 1 }, { 111, 1 } },
+        },
+        {  // Opponent attacking
+            { { 112, 1 }, { 113, 1 }, { 114, 1 }, { 115, 1 }, { 116, 3 }, { 119, 1 }, { 120, 1 } },  // Can't punch
+            { { 121, 1 }, { 122, 1 }, { 123, 1 }, { 124, 1 }, { 125, 3 }, { 128, 1 }, { 129, 1 } },
+        },
+        {  // Opponent squat attacking
+            { { 130, 1 }, { 131, 1 }, { 132, 1 }, { 133, 1 }, { 134, 3 }, { 137, 1 }, { 138, 1 } },  // Can't punch
+            { { 139, 1 }, { 140, 1 }, { 141, 1 }, { 142, 1 }, { 143, 3 }, { 146, 1 }, { 147, 1 } },
+        },
+    },
+    {  // BALANCED
+        {  // Opponent neutral
+            { { 148, 1 }, { 149, 1 }, { 150, 1 }, { 151, 1 }, { 152, 1 }, { 153, 1 }, { 154, 1 } },  // Can't punch
+            { { 155, 2 }, { 157, 1 }, { 158, 1 }, { 159, 1 }, { 160, 1 }, { 161, 1 }, { 162, 1 } },
+        },
+        {  // Opponent hit
+            { { 163, 1 }, { 164, 1 }, { 165, 1 }, { 166, 1 }, { 167, 1 }, { 168, 1 }, { 169, 1 } },  // Can't punch
+            { { 170, 2 }, { 172, 1 }, { 173, 1 }, { 174, 1 }, { 175, 1 }, { 176, 1 }, { 177, 1 } },
+        },
+        {  // Opponent attacking
+            { { 178, 1 }, { 179, 1 }, { 180, 1 }, { 181, 1 }, { 182, 1 }, { 183, 1 }, { 184, 1 } },  // Can't punch
+            { { 185, 1 }, { 186, 1 }, { 187, 1 }, { 188, 1 }, { 189, 1 }, { 190, 1 }, { 191, 1 } },
+        },
+        {  // Opponent squat attacking
+            { { 192, 1 }, { 193, 1 }, { 194, 1 }, { 195, 1 }, { 196, 1 }, { 197, 1 }, { 198, 1 } },  // Can't punch
+            { { 199, 1 }, { 200, 1 }, { 201, 1 }, { 202, 1 }, { 203, 1 }, { 204, 1 }, { 205, 1 } },
+        },
+    },
+    {  // RANDOM
+        {  // Opponent neutral
+            { { 206, 5 }, { 211, 5 }, { 216, 5 }, { 221, 5 }, { 226, 5 }, { 231, 5 }, { 236, 5 } },  // Can't punch
+            { { 241, 7 }, { 248, 7 }, { 255, 7 }, { 262, 7 }, { 269, 7 }, { 276, 7 }, { 283, 7 } },
+        },
+        {  // Opponent hit
+            { { 290, 5 }, { 295, 5 }, { 300, 5 }, { 305, 5 }, { 310, 5 }, { 315, 5 }, { 320, 5 } },  // Can't punch
+            { { 325, 7 }, { 332, 7 }, { 339, 7 }, { 346, 7 }, { 353, 7 }, { 360, 7 }, { 367, 7 } },
+        },
+        {  // Opponent attacking
+            { { 374, 5 }, { 379, 5 }, { 384, 5 }, { 389, 5 }, { 394, 5 }, { 399, 5 }, { 404, 5 } },  // Can't punch
+            { { 409, 7 }, { 416, 7 }, { 423, 7 }, { 430, 7 }, { 437, 7 }, { 444, 7 }, { 451, 7 } },
+        },
+        {  // Opponent squat attacking
+            { { 458, 5 }, { 463, 5 }, { 468, 5 }, { 473, 5 }, { 478, 5 }, { 483, 5 }, { 488, 5 } },  // Can't punch
+            { { 493, 7 }, { 500, 7 }, { 507, 7 }, { 514, 7 }, { 521, 7 }, { 528, 7 }, { 535, 7 } },
+        },
+    },
+};
@@ -0,0 +1,116 @@
+#pragma once
+
+// Written by    : src/host/tune_ai.cpp - hand edits are fine too
+// Last tuning   : none - the original hand-set numbers
+//
+// Numbers each heuristic personality plays by (AI_PARAMS in ai_player.h).
+// The game runs the policy tables built from these, so rebuild
+// src/ai_policy.h with src/host/gen_policy.cpp after any change. Fields a
+// personality does not use are 0.
+
+constexpr AIParams ai_presets[AI_PRESET_COUNT] = {
+    {  // AGGRESSIVE
+        35,  // punchRange
+        0,   // blockRange
+        45,  // closeRange
+        70,  // mediumRange
+        0,   // retreatRange
+        0,   // advanceRange
+        0,   // pokeRange
+        40,  // punishLowChance
+        30,  // lowPunchChance
+        0,   // closeAttackChance
+        0,   // mediumAttackChance
+        0,   // pokeChance
+        0,   // shuffleChance
+        6,   // punchHold
+        0,   // blockHold
+        4,   // closeHold
+        0,   // retreatHold
+        8,   // mediumHold
+        10,  // farHold
+        0,   // pokeHold
+        0,   // shuffleHold
+        0,   // idleHold
+        0,   // randomHold
+        0,   // randomHoldSpread
+    },
+    {  // DEFENSIVE
+        35,  // punchRange
+        45,  // blockRange
+        0,   // closeRange
+        0,   // mediumRange
+        40,  // retreatRange
+        65,  // advanceRange
+        40,  // pokeRange
+        0,   // punishLowChance
+        0,   // lowPunchChance
+        0,   // closeAttackChance
+        0,   // mediumAttackChance
+        20,  // pokeChance
+        30,  // shuffleChance
+        6,   // punchHold
+        12,  // blockHold
+        0,   // closeHold
+        6,   // retreatHold
+        0,   // mediumHold
+        6,   // farHold
+        5,   // pokeHold
+        5,   // shuffleHold
+        4,   // idleHold
+        0,   // randomHold
+        0,   // randomHoldSpread
+    },
+    {  // BALANCED
+        35,  // punchRange
+        45,  // blockRange
+        45,  // closeRange
+        70,  // mediumRange
+        0,   // retreatRange
+        0,   // advanceRange
+        0,   // pokeRange
+        35,  // punishLowChance
+        0,   // lowPunchChance
+        60,  // closeAttackChance
+        35,  // mediumAttackChance
+        0,   // pokeChance
+        0,   // shuffleChance
+        6,   // punchHold
+        10,  // blockHold
+        0,   // closeHold
+        5,   // retreatHold
+        7,   // mediumHold
+        8,   // farHold
+        0,   // pokeHold
+        0,   // shuffleHold
+        0,   // idleHold
+        0,   // randomHold
+        0,   // randomHoldSpread
+    },
+    {  // RANDOM
+        0,   // punchRange
+        0,   // blockRange
+        0,   // closeRange
+        0,   // mediumRange
+        0,   // retreatRange
+        0,   // advanceRange
+        0,   // pokeRange
+        0,   // punishLowChance
+        0,   // lowPunchChance
+        0,   // closeAttackChance
+        0,   // mediumAttackChance
+        0,   // pokeChance
+        0,   // shuffleChance
+        0,   // punchHold
+        0,   // blockHold
+        0,   // closeHold
+        0,   // retreatHold
+        0,   // mediumHold
+        0,   // farHold
+        0,   // pokeHold
+        0,   // shuffleHold
+        0,   // idleHold
+        5,   // randomHold
+        10,  // randomHoldSpread
+    },
+};
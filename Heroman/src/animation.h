@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdint.h>
+
+// Fighter animations: one table entry per animation, describing the sprite
+// frames it steps through and how it behaves
+//
+// A Player holds only an animation ID and a frame cursor into this table.
+// Adding an animation is a new line in ANIMATIONS below - the ID, the table
+// entry and the frame count all come from it.
+
+#define ANIMATION_FRAME_DELAY 2  // Update animation every N frames for smoother look
+#define ANIMATION_MAX_FRAMES 8
+
+// What happens after the last frame
+enum AnimationMode : uint8_t {
+    ANIM_LOOP,  // Back to the first frame
+    ANIM_ONCE,  // Stay on the last frame
+};
+
+// Animation flags
+#define ANIM_LOCKED 0x01  // Not interruptible - plays to its last frame before input is read again
+#define ANIM_ATTACK 0x02  // A punch - checkCombat() tests its hitboxes (see sprite_boxes.h)
+#define ANIM_HIGH   0x04  // High attack - the victim staggers high rather than low
+#define ANIM_SQUAT  0x08  // Fighter is crouched
+
+// X(name, mode, ticksPerFrame, flags, sprite frames...)
+// IDs are assigned in order. The jump animations are not drawn yet:
+//   ANIMATION_JUMPPUNCHING_HIGH  frame 11 (row 2, image 4: jump high punch)
+//   ANIMATION_JUMPPUNCHING_LOW   frame 12 (row 2, image 5: jump low punch)
+//   ANIMATION_JUMPBLOCKING       frame 10 (row 2, image 3: jump block)
+#define ANIMATIONS(X) \
+    X(ANIMATION_STOPPED,            ANIM_LOOP, ANIMATION_FRAME_DELAY, 0,                                    0) \
+    X(ANIMATION_RUNNING,            ANIM_LOOP, ANIMATION_FRAME_DELAY, 0,                                    20, 21, 22, 23, 24, 25, 26, 27) \
+    X(ANIMATION_PUNCHING_HIGH,      ANIM_LOOP, ANIMATION_FRAME_DELAY, ANIM_LOCKED | ANIM_ATTACK | ANIM_HIGH, 3, 3)  /* Punch frame duplicated - more visible! */ \
+    X(ANIMATION_PUNCHING_LOW,       ANIM_LOOP, ANIMATION_FRAME_DELAY, ANIM_LOCKED | ANIM_ATTACK,            4, 4) \
+    X(ANIMATION_SQUATTING,          ANIM_LOOP, ANIMATION_FRAME_DELAY, ANIM_SQUAT,                           1) \
+    X(ANIMATION_SQUATPUNCHING_HIGH, ANIM_LOOP, ANIMATION_FRAME_DELAY, ANIM_LOCKED | ANIM_ATTACK | ANIM_SQUAT, 17, 17) \
+    X(ANIMATION_SQUATPUNCHING_LOW,  ANIM_LOOP, ANIMATION_FRAME_DELAY, ANIM_LOCKED | ANIM_ATTACK | ANIM_SQUAT, 18, 18) \
+    X(ANIMATION_BLOCKING,           ANIM_LOOP, ANIMATION_FRAME_DELAY, ANIM_LOCKED,                          2)  /* Row 1, image 3: standing block */ \
+    X(ANIMATION_SQUATBLOCKING,      ANIM_LOOP, ANIMATION_FRAME_DELAY, ANIM_LOCKED | ANIM_SQUAT,             16) /* Row 3, image 3: squat block */ \
+    X(ANIMATION_STAGGER,            ANIM_LOOP, ANIMATION_FRAME_DELAY, 0,                                    8)  /* High hit reaction */ \
+    X(ANIMATION_STAGGER_LOW,        ANIM_LOOP, ANIMATION_FRAME_DELAY, 0,                                    7)  /* Low hit reaction */ \
+    X(ANIMATION_KNOCKDOWN,          ANIM_LOOP, ANIMATION_FRAME_DELAY, 0,                                    14, 15) \
+    X(ANIMATION_DYING,              ANIM_ONCE, ANIMATION_FRAME_DELAY, 0,                                    8, 14, 15)  /* Flinch, then fall */ \
+    X(ANIMATION_DEAD,               ANIM_ONCE, ANIMATION_FRAME_DELAY, 0,                                    15)  /* On the ground */
+
+#define ANIMATION_ID(name, mode, ticksPerFrame, flags, ...) name,
+enum AnimationId : uint8_t {
+    ANIMATIONS(ANIMATION_ID)
+    ANIMATION_COUNT
+};
+#undef ANIMATION_ID
+
+struct AnimationDef {
+    uint8_t frames[ANIMATION_MAX_FRAMES];  // Sprite image for each frame
+    uint8_t frameCount;
+    uint8_t ticksPerFrame;  // How long setAnimation() holds each frame
+    uint8_t restartFrame;   // Frame after the last one (ANIM_LOOP: 0, ANIM_ONCE: the last)
+    uint8_t flags;          // ANIM_*
+};
+
+template <typename... Frames>
+constexpr uint8_t countFrames(Frames...) {
+    return sizeof...(Frames);
+}
+
+#define ANIMATION_DEF(name, mode, ticksPerFrame, flags, ...) \
+    { { __VA_ARGS__ }, countFrames(__VA_ARGS__), ticksPerFrame, \
+      (uint8_t)((mode) == ANIM_LOOP ? 0 : countFrames(__VA_ARGS__) - 1), flags },
+constexpr AnimationDef animations[ANIMATION_COUNT] = {
+    ANIMATIONS(ANIMATION_DEF)
+};
+#undef ANIMATION_DEF
+
+constexpr bool animationsValid(int i = 0) {
+    return i == ANIMATION_COUNT ||
+           (animations[i].frameCount >= 1 && animations[i].frameCount <= ANIMATION_MAX_FRAMES &&
+            animations[i].ticksPerFrame >= 1 && animationsValid(i + 1));
+}
+static_assert(animationsValid(), "every animation needs 1 to ANIMATION_MAX_FRAMES frames and ticksPerFrame >= 1");
+
+inline bool animationHas(uint8_t animation, uint8_t flags) {
+    return (animations[animation].flags & flags) != 0;
+}
+
+// Sprite image shown for frame of animation
+inline int animationImage(uint8_t animation, uint8_t frame) {
+    return animations[animation].frames[frame];
+}
+
+// The frame after frame - a lookup and a select, no per-animation branches
+inline uint8_t animationNextFrame(uint8_t animation, uint8_t frame) {
+    const AnimationDef& a = animations[animation];
+    uint8_t next = frame + 1;
+    return next < a.frameCount ? next : a.restartFrame;
+}
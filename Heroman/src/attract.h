@@ -0,0 +1,60 @@
+#pragma once
+
+#include "simulation.h"
+#include "input_record.h"
+#include "attract_replay.h"
+
+// Attract mode played from a stored fight instead of the live AI
+//
+// attract_replay.h holds the input of one CPU vs CPU fight, generated on
+// the host by src/host/make_attract.cpp. It runs from a freshly reset menu
+// to the return to the menu after the victory sequence, so looping it
+// replays the same fight on every unit without running ai_make_decision.
+// Start still interrupts it, exactly as it interrupts the live AI.
+//
+// The fight was recorded on an ATTRACT_REPLAY_WIDTH wide arena; on any
+// other width the AI plays live as before.
+
+struct AttractMode {
+    InputDecoder decoder;
+    bool active;  // The stored fight is driving the menu
+};
+
+AttractMode attract;
+
+void attractStart(GameState& gs)
+{
+    // The stored fight begins with both fighters on their marks
+    resetPlayers(gs);
+    inputDecoderInit(&attract.decoder, attract_replay, sizeof(attract_replay));
+    attract.active = true;
+}
+
+// Call before every step(): swaps in the stored fight while nobody plays
+void attractTick(GameState& gs, TickInputs* in)
+{
+    if (gs.screenWidth != ATTRACT_REPLAY_WIDTH) return;
+
+    // A recording is playing back, or a real match is on
+    if (in->overrideAI || gs.gameState == GAME_COUNTDOWN || gs.gameState == GAME_PLAYING) {
+        attract.active = false;
+        return;
+    }
+
+    if (gs.gameState == GAME_MENU && !attract.active) {
+        attractStart(gs);
+    }
+    if (!attract.active) return;  // Victory sequence of a real match
+
+    InputFrame frame;
+    if (!inputDecode(&attract.decoder, &frame)) {
+        if (gs.gameState != GAME_MENU) return;
+        attractStart(gs);  // Loop the fight
+        if (!inputDecode(&attract.decoder, &frame)) return;
+    }
+
+    // Start and the gamepads stay live so a player can still take over
+    in->buttons[0] = frame.ctrlState[0];
+    in->buttons[1] = frame.ctrlState[1];
+    in->overrideAI = true;
+}
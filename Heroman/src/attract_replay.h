@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <pgmspace.h>
+
+// Generated by  : src/host/make_attract.cpp - do not edit by hand
+// Fight         : AGGRESSIVE vs AGGRESSIVE, seed 337
+// Result        : player 1 wins with 20 health after 17.1 s, hits 10/8, squat dodges 10/8
+//
+// Input stream (input_record.h format) for one attract-mode fight, from a
+// freshly reset menu until the game is back on the menu after the victory
+// sequence, so it loops without a seam.
+
+#define ATTRACT_REPLAY_WIDTH 128
+#define ATTRACT_REPLAY_TICKS 677
+
+const uint8_t attract_replay[351] PROGMEM = {
+0x03, 0x08, 0x04, 0x87, 0x03, 0x40, 0x40, 0x85, 0x03, 0x08, 0x04, 0x83, 0x03, 0x40, 0x82, 0x01,
+0x85, 0x03, 0x08, 0x04, 0x83, 0x01, 0x40, 0x83, 0x02, 0x40, 0x80, 0x01, 0x08, 0x83, 0x01, 0x82,
+0x01, 0x85, 0x03, 0x08, 0x04, 0x83, 0x01, 0x40, 0x83, 0x02, 0x40, 0x80, 0x01, 0x08, 0x83, 0x01,
+0x82, 0x01, 0x85, 0x03, 0x08, 0x04, 0x83, 0x01, 0x40, 0x83, 0x02, 0x40, 0x80, 0x01, 0x08, 0x83,
+0x01, 0x40, 0x85, 0x03, 0x08, 0x04, 0x83, 0x01, 0x82, 0x01, 0x83, 0x02, 0x40, 0x80, 0x01, 0x08,
+0x83, 0x03, 0x82, 0x01, 0x82, 0x01, 0x85, 0x03, 0x08, 0x04, 0x83, 0x01, 0x82, 0x01, 0x83, 0x02,
+0x40, 0x80, 0x01, 0x08, 0x83, 0x01, 0x82, 0x01, 0x85, 0x03, 0x08, 0x04, 0x83, 0x01, 0x82, 0x01,
+0x83, 0x02, 0x40, 0x80, 0x01, 0x08, 0x83, 0x01, 0x82, 0x01, 0x85, 0x03, 0x08, 0x04, 0x83, 0x01,
+0x40, 0x83, 0x02, 0x40, 0x80, 0x01, 0x08, 0x83, 0x03, 0x40, 0x04, 0x83, 0x02, 0x40, 0x80, 0x01,
+0x82, 0x01, 0x83, 0x02, 0x04, 0x80, 0x01, 0x08, 0x81, 0x02, 0x40, 0x80, 0x01, 0x82, 0x01, 0x83,
+0x02, 0x04, 0x80, 0x01, 0x40, 0x81, 0x02, 0x40, 0x82, 0x01, 0x08, 0x81, 0x02, 0x04, 0x83, 0x02,
+0x40, 0x80, 0x01, 0x40, 0x83, 0x02, 0x04, 0x83, 0x02, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81,
+0x02, 0x04, 0x82, 0x01, 0x08, 0x02, 0x40, 0x82, 0x01, 0x40, 0x81, 0x02, 0x04, 0x83, 0x02, 0x82,
+0x01, 0x84, 0x01, 0x08, 0x02, 0x04, 0x83, 0x02, 0x40, 0x82, 0x01, 0x40, 0x81, 0x02, 0x04, 0x83,
+0x02, 0x40, 0x84, 0x01, 0x08, 0x02, 0x04, 0x83, 0x02, 0x82, 0x01, 0x82, 0x01, 0x40, 0x81, 0x02,
+0x04, 0x83, 0x02, 0x82, 0x01, 0x84, 0x01, 0x08, 0x02, 0x04, 0x83, 0x02, 0x82, 0x01, 0x82, 0x01,
+0x40, 0x81, 0x02, 0x04, 0x83, 0x02, 0x82, 0x01, 0x84, 0x01, 0x08, 0x02, 0x04, 0x83, 0x02, 0x82,
+0x01, 0x82, 0x01, 0x40, 0x81, 0x02, 0x04, 0x83, 0x02, 0x82, 0x01, 0x84, 0x01, 0x08, 0x02, 0x04,
+0x83, 0x02, 0x40, 0x82, 0x01, 0x40, 0x81, 0x02, 0x04, 0x82, 0x01, 0x08, 0x02, 0x82, 0x01, 0x82,
+0x01, 0x40, 0x81, 0x02, 0x40, 0x82, 0x01, 0x08, 0x81, 0x02, 0x04, 0x80, 0x01, 0x40, 0x81, 0x02,
+0x40, 0x82, 0x01, 0x08, 0x83, 0x01, 0x82, 0x01, 0x83, 0x02, 0x04, 0x80, 0x01, 0x08, 0x83, 0x01,
+0x82, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+};
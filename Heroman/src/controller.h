@@ -2,26 +2,10 @@
 
 #include <stdint.h>
 #include <Bluepad32.h>
-#include "ESP32-HUB75-MatrixPanel-I2S-DMA.h"
-
-// Forward declarations to avoid circular dependencies
-struct Player;
-struct AIController;
-
-// Button bit positions - keep same layout as before for compatibility
-#define UP_BTN          0
-#define DOWN_BTN        1
-#define LEFT_BTN        2
-#define RIGHT_BTN       3
-#define SELECT_BTN      4
-#define START_BTN       5
-#define PUNCH_BTN       6  // A button
-#define JUMP_BTN        7  // B button
-#define TRI_BTN         8  // Y button
-#define X_BTN           9  // X button
-
-#define BUTTON_PRESSED(button, state) !((state >> button) & 1)
-#define IS_MOVING(state) (BUTTON_PRESSED(LEFT_BTN, state) | BUTTON_PRESSED(RIGHT_BTN, state))
+#include "ctrl_state.h"
+#include "simulation.h"
+#include "render_target.h"
+#include "dirty_rect.h"
 
 // RGB565 colors for visual debugging
 #define COLOR_RED     0xF800
@@ -30,19 +14,6 @@ struct AIController;
 #define COLOR_YELLOW  0xFFE0
 #define COLOR_WHITE   0xFFFF
 
-// External reference to LED matrix display (defined in main.cpp)
-extern MatrixPanel_I2S_DMA *dma_display;
-
-// Forward declare AI controller struct (defined in ai_player.h)
-struct AIController;
-
-// External references to AI controllers (defined in main.cpp)
-extern AIController aiPlayer1;
-extern AIController aiPlayer2;
-
-// Forward declare AI decision function
-uint32_t ai_make_decision(AIController* ai);
-
 // Status flag
 bool BluePadSetupComplete = false;
 
@@ -54,23 +25,16 @@ GamepadPtr player2Gamepad = nullptr;
 void onConnectedGamepad(GamepadPtr gp) {
     Serial.printf("Gamepad connected, idx=%d\n", gp->index());
 
-    // Visual indicator: GREEN circle at top-left = gamepad connected
-    dma_display->fillCircle(10, 10, 5, COLOR_GREEN);
-
     // Assign to first available player slot
+    // The menu's gamepad icons pick up the change on the next frame
     if (player1Gamepad == nullptr) {
         player1Gamepad = gp;
         Serial.println("Gamepad assigned to Player 1");
-        // Draw indicator for Player 1 (left side)
-        dma_display->fillRect(0, 0, 10, 10, COLOR_GREEN);
     } else if (player2Gamepad == nullptr) {
         player2Gamepad = gp;
         Serial.println("Gamepad assigned to Player 2");
-        // Draw indicator for Player 2 (right side)
-        dma_display->fillRect(118, 0, 10, 10, COLOR_BLUE);
     } else {
         Serial.println("Warning: More than 2 gamepads connected, ignoring");
-        dma_display->fillCircle(64, 10, 5, COLOR_YELLOW);
     }
 }
 
@@ -78,27 +42,16 @@ void onConnectedGamepad(GamepadPtr gp) {
 void onDisconnectedGamepad(GamepadPtr gp) {
     Serial.printf("Gamepad disconnected, idx=%d\n", gp->index());
 
-    // Visual indicator: RED circle at top-left = gamepad disconnected
-    dma_display->fillCircle(10, 10, 5, COLOR_RED);
-
     // Clear the appropriate player gamepad reference
     if (player1Gamepad == gp) {
         player1Gamepad = nullptr;
         Serial.println("Player 1 gamepad disconnected");
-        // Clear Player 1 indicator
-        dma_display->fillRect(0, 0, 10, 10, COLOR_RED);
     } else if (player2Gamepad == gp) {
         player2Gamepad = nullptr;
         Serial.println("Player 2 gamepad disconnected");
-        // Clear Player 2 indicator
-        dma_display->fillRect(118, 0, 10, 10, COLOR_RED);
     }
 }
 
-bool isMoving(uint32_t ctrlState) {
-    return (BUTTON_PRESSED(LEFT_BTN, ctrlState) || BUTTON_PRESSED(RIGHT_BTN, ctrlState));
-}
-
 void initializeController() {
     Serial.println("Initializing Bluepad32...");
     Serial.flush(); // Make sure message is sent before BP32.setup()
@@ -129,31 +82,16 @@ void initializeController() {
     Serial.flush();
 
     // Visual indicator: Show white square at startup to confirm init
-    dma_display->fillRect(60, 0, 8, 8, COLOR_WHITE);
+    // (drawn outside drawFrame, so the first frames repaint the whole screen)
+    renderTarget->fillRect(60, 0, 8, 8, COLOR_WHITE);
+    invalidateScreen();
 }
 
-// Forward declare controller functions needed by heroman.h (which is included by ai_player.h)
-uint32_t controller_read_state(int playerNumber);
-
-// Include full AI definition before function implementations
-// This must come after button defines and forward declarations
-#include "ai_player.h"
-
-// Read controller state for a specific player (1 or 2)
-uint32_t controller_read_state(int playerNumber) {
-    // Check if AI is enabled for this player
-    AIController* ai = (playerNumber == 1) ? &aiPlayer1 : &aiPlayer2;
-    if (ai->enabled) {
-        return ai_make_decision(ai);  // Return AI decision instead of gamepad input
-    }
-
-    // Otherwise use real gamepad input
-    // Get the gamepad for this player
-    GamepadPtr gp = (playerNumber == 1) ? player1Gamepad : player2Gamepad;
-
+// Read the button state of one gamepad
+uint32_t readGamepadState(GamepadPtr gp) {
     // If no gamepad connected for this player, return neutral state (all buttons not pressed)
     if (gp == nullptr || !gp->isConnected()) {
-        return 0xFFFFFFFF;  // All bits set = no buttons pressed
+        return CTRL_STATE_IDLE;
     }
 
     // Read D-pad state
@@ -185,3 +123,23 @@ uint32_t controller_read_state(int playerNumber) {
                       | (y << X_BTN       /*9*/)
                       );
 }
+
+// Gather this tick's input for the simulation - the only place gamepads are read
+TickInputs readTickInputs() {
+    TickInputs in;
+    GamepadPtr gamepads[2] = { player1Gamepad, player2Gamepad };
+    in.startPressed = false;
+    in.overrideAI = false;
+
+    for (int i = 0; i < 2; i++) {
+        GamepadPtr gp = gamepads[i];
+        in.gamepadConnected[i] = (gp != nullptr && gp->isConnected());
+        in.buttons[i] = readGamepadState(gp);
+
+        // Only a real player's A button starts a match from the menu
+        if (in.gamepadConnected[i] && (gp->buttons() & BUTTON_A)) {
+            in.startPressed = true;
+        }
+    }
+    return in;
+}
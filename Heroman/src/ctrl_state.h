@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+// Controller state word shared by gamepads, AI and the simulation
+// One bit per button, active low: a cleared bit means the button is held.
+
+// Button bit positions - keep same layout as before for compatibility
+#define UP_BTN          0
+#define DOWN_BTN        1
+#define LEFT_BTN        2
+#define RIGHT_BTN       3
+#define SELECT_BTN      4
+#define START_BTN       5
+#define PUNCH_BTN       6  // A button
+#define JUMP_BTN        7  // B button
+#define TRI_BTN         8  // Y button
+#define X_BTN           9  // X button
+
+#define CTRL_STATE_IDLE 0xFFFFFFFF  // No buttons pressed
+
+#define BUTTON_PRESSED(button, state) !((state >> button) & 1)
+#define IS_MOVING(state) (BUTTON_PRESSED(LEFT_BTN, state) | BUTTON_PRESSED(RIGHT_BTN, state))
+
+inline bool isMoving(uint32_t ctrlState) {
+    return (BUTTON_PRESSED(LEFT_BTN, ctrlState) || BUTTON_PRESSED(RIGHT_BTN, ctrlState));
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <stdint.h>
+
+// Dirty-rectangle bookkeeping for drawFrame()
+//
+// Every drawable on screen (fighters, health bars, floor, text overlays,
+// gamepad icons) occupies a fixed slot. Each frame the renderer fills in the
+// slot's bounding box and a signature of whatever affects its pixels. Only
+// slots whose box or signature changed get cleared and redrawn, together with
+// anything they overlap.
+//
+// The panel is double buffered (mxconfig.double_buff), so the buffer we draw
+// into holds the frame from two flips ago. History is kept per buffer.
+
+#define DIRTY_BUFFER_COUNT 2
+
+enum DrawableSlot {
+    SLOT_HEALTH_BAR_P1 = 0,
+    SLOT_HEALTH_BAR_P2,
+    SLOT_PLAYER_BACK,   // Drawn first (player 1, or the loser during victory)
+    SLOT_PLAYER_FRONT,  // Drawn on top
+    SLOT_FLOOR,
+    SLOT_TITLE,
+    SLOT_PRESS_START,
+    SLOT_GAMEPAD_ICON_P1,
+    SLOT_GAMEPAD_ICON_P2,
+    SLOT_COUNTDOWN_TEXT,
+    SLOT_VICTORY_TEXT,
+    SLOT_COUNT
+};
+
+struct Rect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+struct Drawable {
+    Rect rect;           // Screen area touched when drawn (w/h of 0 = not visible)
+    uint32_t signature;  // Anything besides the rect that changes the pixels
+};
+
+struct DirtyTracker {
+    Drawable history[DIRTY_BUFFER_COUNT][SLOT_COUNT];  // What each buffer holds
+    Drawable current[SLOT_COUNT];                       // What this frame wants
+    Rect dirty[SLOT_COUNT * 3];                         // Areas to clear and redraw
+    int dirtyCount;
+    bool redraw[SLOT_COUNT];                            // Slots to redraw this frame
+    volatile bool needsFullRedraw[DIRTY_BUFFER_COUNT];
+    int backBuffer;
+};
+
+DirtyTracker dirtyTracker = {};
+
+inline Rect makeRect(int x, int y, int w, int h) {
+    Rect r = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+    return r;
+}
+
+inline bool rectIsEmpty(const Rect& r) {
+    return r.w <= 0 || r.h <= 0;
+}
+
+inline bool rectsEqual(const Rect& a, const Rect& b) {
+    if (rectIsEmpty(a) && rectIsEmpty(b)) return true;
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+inline bool rectsIntersect(const Rect& a, const Rect& b) {
+    if (rectIsEmpty(a) || rectIsEmpty(b)) return false;
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+// Force the next frame drawn into each buffer to repaint the whole screen
+// Call this after drawing to the panel outside drawFrame()
+void invalidateScreen() {
+    for (int b = 0; b < DIRTY_BUFFER_COUNT; b++) {
+        dirtyTracker.needsFullRedraw[b] = true;
+    }
+}
+
+// Start a new frame - call once per flip, before setting any drawables
+void dirtyBeginFrame() {
+    dirtyTracker.backBuffer = (dirtyTracker.backBuffer + 1) % DIRTY_BUFFER_COUNT;
+    for (int i = 0; i < SLOT_COUNT; i++) {
+        dirtyTracker.current[i].rect = makeRect(0, 0, 0, 0);
+        dirtyTracker.current[i].signature = 0;
+    }
+}
+
+// Declare what a slot shows this frame
+void dirtySetDrawable(int slot, const Rect& rect, uint32_t signature) {
+    dirtyTracker.current[slot].rect = rect;
+    dirtyTracker.current[slot].signature = signature;
+}
+
+void dirtyAddRect(const Rect& r) {
+    if (!rectIsEmpty(r) && dirtyTracker.dirtyCount < SLOT_COUNT * 3) {
+        dirtyTracker.dirty[dirtyTracker.dirtyCount++] = r;
+    }
+}
+
+// Work out which areas must be cleared and which slots redrawn
+// Returns true if the whole screen must be repainted instead
+bool dirtyResolve() {
+    DirtyTracker& t = dirtyTracker;
+    Drawable* previous = t.history[t.backBuffer];
+    bool fullRedraw = t.needsFullRedraw[t.backBuffer];
+
+    t.dirtyCount = 0;
+    for (int i = 0; i < SLOT_COUNT; i++) {
+        t.redraw[i] = fullRedraw && !rectIsEmpty(t.current[i].rect);
+        if (fullRedraw) continue;
+
+        bool moved = !rectsEqual(previous[i].rect, t.current[i].rect);
+        bool changed = previous[i].signature != t.current[i].signature;
+        if (moved || (changed && !rectIsEmpty(t.current[i].rect))) {
+            dirtyAddRect(previous[i].rect);
+            dirtyAddRect(t.current[i].rect);
+            t.redraw[i] = !rectIsEmpty(t.current[i].rect);
+        }
+    }
+
+    // Anything overlapping a dirty area is repainted in full, which in turn
+    // dirties its whole box - repeat until nothing new gets pulled in
+    bool grew = !fullRedraw;
+    while (grew) {
+        grew = false;
+        for (int i = 0; i < SLOT_COUNT; i++) {
+            if (t.redraw[i] || rectIsEmpty(t.current[i].rect)) continue;
+            for (int d = 0; d < t.dirtyCount; d++) {
+                if (rectsIntersect(t.current[i].rect, t.dirty[d])) {
+                    t.redraw[i] = true;
+                    dirtyAddRect(t.current[i].rect);
+                    grew = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Remember what this buffer will hold once drawing is done
+    for (int i = 0; i < SLOT_COUNT; i++) {
+        previous[i] = t.current[i];
+    }
+    t.needsFullRedraw[t.backBuffer] = false;
+
+    return fullRedraw;
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+// Binary event log for the game loop
+//
+// Formatting text and pushing it through a 115200 baud UART can take
+// milliseconds per line, which is far too slow for code that runs every
+// tick. Instead, LOG_EVENT() stores a fixed-size record (event ID, tick
+// number, up to four integer arguments) in a lock-free ring buffer. A
+// low-priority task drains the buffer to Serial as binary frames, and
+// tools/decode_log.py turns the capture back into text using the format
+// strings below. Logging never blocks: when the buffer is full the record is
+// dropped and counted.
+//
+// Each event belongs to a category that can be compiled out, e.g.
+// -DLOG_ENABLE_AI=0. Disabled events generate no code and do not evaluate
+// their arguments.
+
+#ifndef LOG_ENABLE_COMBAT
+#define LOG_ENABLE_COMBAT 1
+#endif
+#ifndef LOG_ENABLE_AI
+#define LOG_ENABLE_AI 1
+#endif
+#ifndef LOG_ENABLE_INPUT
+#define LOG_ENABLE_INPUT 1
+#endif
+#ifndef LOG_ENABLE_STATE
+#define LOG_ENABLE_STATE 1
+#endif
+#ifndef LOG_ENABLE_HASH
+#define LOG_ENABLE_HASH 1  // One record per tick, for comparing runs
+#endif
+
+// X(name, category, format) - format uses printf conversions for the integer
+// arguments only. IDs are assigned in order, so only ever append to the end;
+// tools/decode_log.py reads this table to decode a capture.
+#define LOG_EVENTS(X) \
+    X(EV_PUNCH,          COMBAT, "P%d PUNCH: result=%d (0 miss, 1 hit, 2 over) victim.isHit=%d") \
+    X(EV_SQUAT_DODGE,    COMBAT, "  -> MISS (squat dodge)") \
+    X(EV_HIT,            COMBAT, "  -> HIT!") \
+    X(EV_GAME_OVER,      STATE,  "GAME OVER! Player %d wins!") \
+    X(EV_PROCESS_INPUT,  INPUT,  "processInput P%d: gameState=%d, ctrlState=0x%08X") \
+    X(EV_AI_STATUS,      AI,     "AI P%d: dist=%d, action=0x%08X, dur=%d") \
+    X(EV_AI_DECISION,    AI,     "  -> NEW decision: action=0x%08X, dur=%d, personality=%d") \
+    X(EV_AI_BALANCED,    AI,     "  BALANCED: dist=%d, moveRight=%d") \
+    X(EV_AI_BLOCK,       AI,     "    -> BLOCK") \
+    X(EV_AI_PUNISH,      AI,     "    -> PUNISH") \
+    X(EV_AI_CLOSE_RANGE, AI,     "    -> CLOSE RANGE") \
+    X(EV_AI_MEDIUM,      AI,     "    -> MEDIUM RANGE (dist=%d < %d)") \
+    X(EV_AI_ADVANCING,   AI,     "    -> ADVANCING (moveRight=%d)") \
+    X(EV_AI_FAR_RANGE,   AI,     "    -> FAR RANGE") \
+    X(EV_LOG_DROPPED,    STATE,  "(log buffer full - dropped %d records)") \
+    X(EV_INIT_PLAYER,    STATE,  "initPlayer: Player %d initialized at xPos=%d") \
+    X(EV_COUNTDOWN_START, STATE, "Starting countdown...") \
+    X(EV_AI_ASSIGN,      STATE,  "AI enabled: P1=%d P2=%d (off for players with a gamepad)") \
+    X(EV_FIGHT,          STATE,  "Countdown complete - FIGHT!") \
+    X(EV_HOME_PRESSED,   STATE,  "Home button pressed, returning to menu...") \
+    X(EV_ATTRACT_MODE,   STATE,  "Attract mode resumed - CPU vs CPU demo") \
+    X(EV_FREEZE_END,     STATE,  "Freeze frame ended, starting victory pause") \
+    X(EV_VICTORY_WALK,   STATE,  "Victory pause ended, winner starting walk (startedOnLeft=%d)") \
+    X(EV_WALK,           STATE,  "WALK: winner=%d, loser=%d, target=%d, newPos=%d") \
+    X(EV_TAUNT_START,    STATE,  "Winner reached loser at position %d, starting taunt") \
+    X(EV_SQUAT,          STATE,  "Squat %d/4 complete") \
+    X(EV_TAUNT_DONE,     STATE,  "Taunt complete, freezing before reset") \
+    X(EV_GAME_SEED,      STATE,  "Simulation seed 0x%08X") \
+    X(EV_RECORD_FILE,    STATE,  "Recording match to file %05d (opened=%d)") \
+    X(EV_RECORD_END,     STATE,  "Recorded %d ticks in %d bytes") \
+    X(EV_RECORD_OVERFLOW, STATE, "Recording buffer full after %d bytes - rest of match dropped") \
+    X(EV_RECORD_PRUNE,   STATE,  "Could not delete old recording %05d - recording anyway") \
+    X(EV_PLAYBACK_START, STATE,  "Playing back recording (%d bytes)") \
+    X(EV_PLAYBACK_END,   STATE,  "Playback finished after %d ticks") \
+    X(EV_STATE_HASH,     HASH,   "State hash %08X%08X") \
+    X(EV_AI_LOOKAHEAD,   AI,     "AI P%d lookahead: depth=%d (0 = out of budget), nodes=%d, action=0x%08X")
+
+#define LOG_EVENT_ID(name, category, format) name,
+enum LogEvent : uint16_t {
+    LOG_EVENTS(LOG_EVENT_ID)
+    LOG_EVENT_COUNT
+};
+#undef LOG_EVENT_ID
+
+#define LOG_EVENT_ENABLED(name, category, format) name##_ENABLED = LOG_ENABLE_##category,
+enum LogEventEnabled {
+    LOG_EVENTS(LOG_EVENT_ENABLED)
+};
+#undef LOG_EVENT_ENABLED
+
+#define LOG_ARG_COUNT 4
+
+struct LogRecord {
+    uint16_t event;
+    uint32_t tick;
+    int32_t args[LOG_ARG_COUNT];
+};
+
+// Bounded lock-free queue (Vyukov style): any task may log, one task drains.
+// Each cell's sequence number says whether it is free for the writer at that
+// position or holds a record for the reader.
+#define LOG_CAPACITY 256  // Records - must be a power of two
+
+struct LogCell {
+    std::atomic<uint32_t> sequence;
+    LogRecord record;
+};
+
+struct EventLog {
+    LogCell cells[LOG_CAPACITY];
+    std::atomic<uint32_t> writePos;
+    uint32_t readPos;                  // Owned by the drain task
+    std::atomic<uint32_t> dropped;     // Records lost to a full buffer
+    bool initialized;
+};
+
+EventLog eventLog;
+
+// Tick number stamped on every record - the simulation keeps this current
+volatile uint32_t logTick = 0;
+
+#define LOG_ENABLE_ANY (LOG_ENABLE_COMBAT || LOG_ENABLE_AI || LOG_ENABLE_INPUT || LOG_ENABLE_STATE || LOG_ENABLE_HASH)
+
+// Compiles away with logging off, so headless builds that simulate on many
+// threads at once never share the global
+inline void logSetTick(uint32_t tick) {
+    if (LOG_ENABLE_ANY) logTick = tick;
+}
+
+void logInit() {
+    for (uint32_t i = 0; i < LOG_CAPACITY; i++) {
+        eventLog.cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    eventLog.writePos.store(0, std::memory_order_relaxed);
+    eventLog.readPos = 0;
+    eventLog.dropped.store(0, std::memory_order_relaxed);
+    eventLog.initialized = true;
+}
+
+void logWrite(uint16_t event, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0, int32_t a3 = 0) {
+    if (!eventLog.initialized) return;
+
+    uint32_t pos = eventLog.writePos.load(std::memory_order_relaxed);
+    LogCell* cell;
+    for (;;) {
+        cell = &eventLog.cells[pos & (LOG_CAPACITY - 1)];
+        uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+        int32_t diff = (int32_t)(sequence - pos);
+        if (diff == 0) {
+            if (eventLog.writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            // Full - drop rather than wait for the drain task
+            eventLog.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = eventLog.writePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->record.event = event;
+    cell->record.tick = logTick;
+    cell->record.args[0] = a0;
+    cell->record.args[1] = a1;
+    cell->record.args[2] = a2;
+    cell->record.args[3] = a3;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+}
+
+// Take the oldest record - drain task only. Returns false if the log is empty.
+bool logRead(LogRecord* out) {
+    LogCell* cell = &eventLog.cells[eventLog.readPos & (LOG_CAPACITY - 1)];
+    if (cell->sequence.load(std::memory_order_acquire) != eventLog.readPos + 1) {
+        return false;
+    }
+    *out = cell->record;
+    cell->sequence.store(eventLog.readPos + LOG_CAPACITY, std::memory_order_release);
+    eventLog.readPos++;
+    return true;
+}
+
+#define LOG_EVENT(name, ...) \
+    do { if (name##_ENABLED) logWrite(name, ##__VA_ARGS__); } while (0)
+
+// Wire format of one record: sync bytes, little-endian fields, then a
+// checksum so the decoder can pick frames out from ordinary text output
+#define LOG_SYNC_0 0xA5
+#define LOG_SYNC_1 0x5A
+#define LOG_FRAME_SIZE (2 + 2 + 4 + 4 * LOG_ARG_COUNT + 1)
+
+int logEncode(const LogRecord& r, uint8_t* out) {
+    int n = 0;
+    out[n++] = LOG_SYNC_0;
+    out[n++] = LOG_SYNC_1;
+    out[n++] = r.event & 0xFF;
+    out[n++] = r.event >> 8;
+    for (int b = 0; b < 4; b++) out[n++] = (r.tick >> (8 * b)) & 0xFF;
+    for (int i = 0; i < LOG_ARG_COUNT; i++) {
+        uint32_t v = (uint32_t)r.args[i];
+        for (int b = 0; b < 4; b++) out[n++] = (v >> (8 * b)) & 0xFF;
+    }
+
+    // Sum of everything after the sync bytes
+    uint8_t sum = 0;
+    for (int i = 2; i < n; i++) sum += out[i];
+    out[n++] = sum;
+    return n;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+
+// Host stand-in for <Bluepad32.h>
+//
+// No Bluetooth on the host, so no gamepad ever connects and every player is
+// driven by the AI. Only what controller.h uses is provided.
+
+#define DPAD_UP    0x01
+#define DPAD_DOWN  0x02
+#define DPAD_RIGHT 0x04
+#define DPAD_LEFT  0x08
+
+#define BUTTON_A 0x0001
+#define BUTTON_B 0x0002
+#define BUTTON_X 0x0004
+#define BUTTON_Y 0x0008
+
+#define MISC_BUTTON_HOME 0x01
+#define MISC_BUTTON_BACK 0x02
+
+class Gamepad {
+public:
+    bool isConnected() const { return false; }
+    int index() const { return 0; }
+    uint8_t dpad() const { return 0; }
+    uint16_t buttons() const { return 0; }
+    uint16_t miscButtons() const { return 0; }
+};
+
+typedef Gamepad* GamepadPtr;
+typedef void (*GamepadCallback)(GamepadPtr gp);
+
+class HostBluepad32 {
+public:
+    void setup(GamepadCallback, GamepadCallback) {}
+    void update() {}
+    void enableBLEService(bool) {}
+    void enableVirtualDevice(bool) {}
+    void enableNewBluetoothConnections(bool) {}
+};
+
+HostBluepad32 BP32;
@@ -0,0 +1,163 @@
+// Host render benchmark
+//
+// Plays a CPU vs CPU match headlessly and times every draw function against
+// an in-memory framebuffer, so render-path changes can be measured without
+// flashing a board. The first quarter of the run is the attract-mode menu,
+// then the match is started as if a player pressed A with no gamepads, and
+// at three quarters player 2 takes a killing blow, so countdown, fight and
+// victory screens are all covered.
+//
+//   pio run -e native_bench
+//   .pio/build/native_bench/program [frames] [--ppm DIR] [--every N] [--scale S]
+//
+// --ppm writes every Nth displayed frame to DIR/frame_NNNNN.ppm.
+
+#include "host_platform.h"
+#include <string.h>
+
+#define RGB565(r, g, b) ((((r) & 0x1F) << 11) | (((g) & 0x3F) << 5) | ((b) & 0x1F))
+
+#include "../render_target.h"
+#include "../controller.h"
+#include "../heroman.h"
+
+FramebufferTarget panel;     // Dirty-tracked frames, as the device would show them
+FramebufferTarget scratch;   // Per-function timing, so the real frames stay intact
+RenderTarget* renderTarget = &panel;
+
+// Draw function behind each slot, for the report
+const char* slotFunctionNames[SLOT_COUNT] = {
+    "drawHealthBar (P1)",
+    "drawHealthBar (P2)",
+    "drawPlayer (back)",
+    "drawPlayer (front)",
+    "drawFloor",
+    "drawMenuTitle",
+    "drawMenuPressStart",
+    "drawGamepadIcon (P1)",
+    "drawGamepadIcon (P2)",
+    "drawCountdown",
+    "drawVictoryText",
+};
+
+struct Timing {
+    long calls;
+    int64_t totalNs;
+};
+
+Timing slotTimings[SLOT_COUNT];
+Timing clearTiming;
+Timing frameTiming;
+
+int64_t nowNs() {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+void addTiming(Timing* t, int64_t start) {
+    t->totalNs += nowNs() - start;
+    t->calls++;
+}
+
+// Time a full repaint of every visible slot, one draw function at a time
+void timeDrawFunctions(const RenderState* s) {
+    renderTarget = &scratch;
+
+    int64_t start = nowNs();
+    scratch.clearScreen();
+    addTiming(&clearTiming, start);
+
+    for (int slot = 0; slot < SLOT_COUNT; slot++) {
+        if (rectIsEmpty(dirtyTracker.current[slot].rect)) continue;
+        start = nowNs();
+        drawSlot(slot, s);
+        addTiming(&slotTimings[slot], start);
+    }
+
+    renderTarget = &panel;
+}
+
+void printTiming(const char* name, const Timing& t, long frames) {
+    if (t.calls == 0) return;
+    printf("  %-22s %8ld calls %10.0f ns/call %10.0f ns/frame\n",
+           name, t.calls, (double)t.totalNs / t.calls, (double)t.totalNs / frames);
+}
+
+int main(int argc, char** argv) {
+    long frames = 2000;
+    const char* ppmDir = nullptr;
+    int ppmEvery = 1;
+    int ppmScale = 4;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--ppm") == 0 && i + 1 < argc) {
+            ppmDir = argv[++i];
+        } else if (strcmp(argv[i], "--every") == 0 && i + 1 < argc) {
+            ppmEvery = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--scale") == 0 && i + 1 < argc) {
+            ppmScale = atoi(argv[++i]);
+        } else {
+            frames = atol(argv[i]);
+        }
+    }
+    if (frames < 1) frames = 1;
+    if (ppmEvery < 1) ppmEvery = 1;
+    if (ppmScale < 1) ppmScale = 1;
+
+    screen_Width = FRAMEBUFFER_WIDTH;
+    screen_Height = FRAMEBUFFER_HEIGHT;
+    init_hero(1);
+
+    RenderState state = {};
+    long slotsRedrawn = 0;
+
+    for (long frame = 0; frame < frames; frame++) {
+        // No gamepads, so both fighters stay on AI
+        TickInputs inputs = {};
+        inputs.buttons[0] = CTRL_STATE_IDLE;
+        inputs.buttons[1] = CTRL_STATE_IDLE;
+
+        // Start the match as if a player pressed A
+        inputs.startPressed = (frame == frames / 4);
+
+        if (frame == frames * 3 / 4 && game.gameState == GAME_PLAYING) {
+            // Land a killing blow so the victory sequence gets drawn too
+            game.player2.health = 1;
+            applyHit(game, &game.player2, &game.player1, false);
+        }
+
+        step(game, inputs);
+        captureRenderState(&state, game);
+
+        int64_t start = nowNs();
+        drawFrame(&state);
+        addTiming(&frameTiming, start);
+
+        for (int slot = 0; slot < SLOT_COUNT; slot++) {
+            slotsRedrawn += dirtyTracker.redraw[slot];
+        }
+
+        timeDrawFunctions(&state);
+
+        if (ppmDir != nullptr && frame % ppmEvery == 0) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/frame_%05ld.ppm", ppmDir, frame);
+            if (!panel.writePPM(path, ppmScale)) {
+                fprintf(stderr, "Could not write %s\n", path);
+                return 1;
+            }
+        }
+    }
+
+    printf("Rendered %ld frames (final state %d, health %d / %d)\n",
+           frames, game.gameState, game.player1.health, game.player2.health);
+    printf("Dirty-rect frames (what the device draws):\n");
+    printTiming("drawFrame", frameTiming, frames);
+    printf("  %-22s %8.2f per frame\n", "slots redrawn", (double)slotsRedrawn / frames);
+    printf("Full repaint, per draw function:\n");
+    printTiming("clearScreen", clearTiming, frames);
+    for (int slot = 0; slot < SLOT_COUNT; slot++) {
+        printTiming(slotFunctionNames[slot], slotTimings[slot], frames);
+    }
+    return 0;
+}
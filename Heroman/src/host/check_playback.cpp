@@ -0,0 +1,116 @@
+// Playback check for the AI_EXPERT search
+//
+// Records a one-player match against an AI_EXPERT CPU, then plays the
+// recording back twice from the same start as the device (see
+// playbackTick()): once plainly, as native_replay does, and once with the
+// device's search running around every tick as simulationTick() runs it.
+// Playback drives both fighters from the recording, so the search must not
+// touch the state, and both runs must give the same state hash every tick.
+// Exits non-zero at the first tick where they differ.
+//
+//   pio run -e native_check_playback
+//   .pio/build/native_check_playback/program [--seed S] [--ticks N]
+
+#define LOG_ENABLE_COMBAT 0
+#define LOG_ENABLE_AI 0
+#define LOG_ENABLE_INPUT 0
+#define LOG_ENABLE_STATE 0
+#define LOG_ENABLE_HASH 0
+
+// The CPU a lone player meets, whatever the build defaults to
+#define VERSUS_CPU_PERSONALITY AI_EXPERT
+
+#include "host_platform.h"
+#include <string.h>
+#include <vector>
+
+#include "../simulation.h"
+#include "../ai_expert.h"
+#include "../input_record.h"
+
+#define ARENA_WIDTH 128
+#define ARENA_HEIGHT 64
+#define BUTTON_HOLD_TICKS 6  // The recorded player changes buttons this often
+
+// Player 1 on a gamepad, mashing buttons, against the CPU searching as the
+// headless tools do. Returns the encoded stream.
+std::vector<uint8_t> recordMatch(uint32_t seed, long maxTicks) {
+    GameState gs;
+    gameInit(gs, ARENA_WIDTH, ARENA_HEIGHT, RECORD_PLAYBACK_SEED);
+
+    std::vector<uint8_t> stream;
+    uint8_t buffer[INPUT_MAX_ENCODED];
+    InputEncoder encoder;
+    inputEncoderInit(&encoder);
+
+    TickInputs in = {};
+    in.buttons[0] = CTRL_STATE_IDLE;
+    in.buttons[1] = CTRL_STATE_IDLE;
+    in.gamepadConnected[0] = true;
+    in.startPressed = true;
+
+    uint32_t rng = seed ? seed : 1;
+    for (long t = 0; t < maxTicks && (t == 0 || gs.gameState != GAME_MENU); t++) {
+        if (t % BUTTON_HOLD_TICKS == 0) {
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+            in.buttons[0] = createButtonState(false, rng & 1, rng & 2, rng & 4, rng & 8, rng & 16, false);
+        }
+        lookaheadThink(gs, in);
+        step(gs, in);
+
+        int n = inputEncode(&encoder, inputFrameAfterStep(gs, in), buffer);
+        stream.insert(stream.end(), buffer, buffer + n);
+        in.startPressed = false;
+    }
+    int n = inputEncodeFlush(&encoder, buffer);
+    stream.insert(stream.end(), buffer, buffer + n);
+    return stream;
+}
+
+// Every tick's state hash, with or without the device's search
+std::vector<uint64_t> playBack(const std::vector<uint8_t>& stream, bool search) {
+    GameState gs;
+    gameInit(gs, ARENA_WIDTH, ARENA_HEIGHT, RECORD_PLAYBACK_SEED);
+
+    std::vector<uint64_t> hashes;
+    InputDecoder decoder;
+    inputDecoderInit(&decoder, &stream[0], stream.size());
+    InputFrame frame;
+    while (inputDecode(&decoder, &frame)) {
+        TickInputs in = tickInputsFromFrame(frame);
+        if (search) lookaheadCollect(gs, in);
+        step(gs, in);
+        if (search && lookaheadPost(gs, in)) lookaheadServe();
+        hashes.push_back(gs.stateHash);
+    }
+    return hashes;
+}
+
+int main(int argc, char** argv) {
+    uint32_t seed = 1;
+    long ticks = 25 * 60 * 3;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            ticks = atol(argv[++i]);
+        }
+    }
+
+    std::vector<uint8_t> stream = recordMatch(seed, ticks);
+    std::vector<uint64_t> plain = playBack(stream, false);
+    std::vector<uint64_t> searched = playBack(stream, true);
+
+    for (size_t t = 0; t < plain.size(); t++) {
+        if (t >= searched.size() || plain[t] != searched[t]) {
+            printf("Tick %u differs with the search running\n", (unsigned)t + 1);
+            return 1;
+        }
+    }
+    printf("%u ticks (%u bytes recorded, seed %u): playback hashes match with and without the search\n",
+           (unsigned)plain.size(), (unsigned)stream.size(), seed);
+    return 0;
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "pgmspace.h"
+#include "../glcdfont.c"
+
+// In-memory stand-in for MatrixPanel_I2S_DMA, used by the host build
+//
+// Implements the subset of the panel / Adafruit GFX interface that heroman.h
+// draws with, into two RGB565 buffers that flip the same way the DMA double
+// buffer does. Text uses the same classic 5x7 font and glyph layout as
+// Adafruit GFX, so frames match the panel pixel for pixel.
+
+#define FRAMEBUFFER_WIDTH 128
+#define FRAMEBUFFER_HEIGHT 64
+
+class FramebufferTarget {
+public:
+    uint16_t buffers[2][FRAMEBUFFER_HEIGHT][FRAMEBUFFER_WIDTH];
+    int backBuffer;  // Buffer being drawn into; the other one is "on screen"
+
+    FramebufferTarget() : backBuffer(0), cursorX(0), cursorY(0), textSize(1), textColor(0xFFFF), wrap(true) {
+        memset(buffers, 0, sizeof(buffers));
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+        if (x < 0 || y < 0 || x >= FRAMEBUFFER_WIDTH || y >= FRAMEBUFFER_HEIGHT) return;
+        buffers[backBuffer][y][x] = color;
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        int x0 = x < 0 ? 0 : x;
+        int y0 = y < 0 ? 0 : y;
+        int x1 = x + w > FRAMEBUFFER_WIDTH ? FRAMEBUFFER_WIDTH : x + w;
+        int y1 = y + h > FRAMEBUFFER_HEIGHT ? FRAMEBUFFER_HEIGHT : y + h;
+        for (int row = y0; row < y1; row++) {
+            for (int col = x0; col < x1; col++) {
+                buffers[backBuffer][row][col] = color;
+            }
+        }
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+        fillRect(x, y, 1, h, color);
+    }
+
+    // Same scanline construction as Adafruit_GFX::fillCircle
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+        drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+
+        int16_t f = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x = 0;
+        int16_t y = r;
+        int16_t px = x;
+        int16_t py = y;
+
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (x < (y + 1)) {
+                drawFastVLine(x0 + x, y0 - y, 2 * y + 1, color);
+                drawFastVLine(x0 - x, y0 - y, 2 * y + 1, color);
+            }
+            if (y != py) {
+                drawFastVLine(x0 + py, y0 - px, 2 * px + 1, color);
+                drawFastVLine(x0 - py, y0 - px, 2 * px + 1, color);
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+    void clearScreen() {
+        memset(buffers[backBuffer], 0, sizeof(buffers[backBuffer]));
+    }
+
+    void flipDMABuffer() {
+        backBuffer ^= 1;
+    }
+
+    // Buffer that would be on the panel right now
+    const uint16_t* frontPixels() const {
+        return &buffers[backBuffer ^ 1][0][0];
+    }
+
+    void setTextSize(uint8_t size) { textSize = size ? size : 1; }
+    void setTextWrap(bool w) { wrap = w; }
+    void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+    void setTextColor(uint16_t color) { textColor = color; }
+
+    void print(const char* text) {
+        while (*text) {
+            write((uint8_t)*text++);
+        }
+    }
+
+    void print(int value) {
+        char text[12];
+        snprintf(text, sizeof(text), "%d", value);
+        print(text);
+    }
+
+    // Write the on-screen buffer as a binary PPM, scaled up by scale
+    bool writePPM(const char* path, int scale) const {
+        FILE* file = fopen(path, "wb");
+        if (file == nullptr) return false;
+
+        fprintf(file, "P6\n%d %d\n255\n", FRAMEBUFFER_WIDTH * scale, FRAMEBUFFER_HEIGHT * scale);
+        const uint16_t* pixels = frontPixels();
+        for (int y = 0; y < FRAMEBUFFER_HEIGHT * scale; y++) {
+            for (int x = 0; x < FRAMEBUFFER_WIDTH * scale; x++) {
+                uint16_t c = pixels[(y / scale) * FRAMEBUFFER_WIDTH + x / scale];
+                uint8_t rgb[3] = {
+                    (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+                    (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+                    (uint8_t)((c & 0x1F) * 255 / 31),
+                };
+                fwrite(rgb, 1, 3, file);
+            }
+        }
+        fclose(file);
+        return true;
+    }
+
+private:
+    int16_t cursorX;
+    int16_t cursorY;
+    uint8_t textSize;
+    uint16_t textColor;
+    bool wrap;
+
+    // Adafruit_GFX::write + drawChar for the classic font, transparent background
+    void write(uint8_t c) {
+        if (c == '\n') {
+            cursorX = 0;
+            cursorY += textSize * 8;
+            return;
+        }
+        if (c == '\r') return;
+
+        if (wrap && cursorX + textSize * 6 > FRAMEBUFFER_WIDTH) {
+            cursorX = 0;
+            cursorY += textSize * 8;
+        }
+        if (c >= 176) c++;  // Adafruit GFX skips a glyph unless cp437 is enabled
+
+        for (int i = 0; i < 5; i++) {
+            uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+            for (int j = 0; j < 8; j++, line >>= 1) {
+                if (line & 1) {
+                    fillRect(cursorX + i * textSize, cursorY + j * textSize, textSize, textSize, textColor);
+                }
+            }
+        }
+        cursorX += textSize * 6;
+    }
+};
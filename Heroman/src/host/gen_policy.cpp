@@ -0,0 +1,387 @@
+// AI policy table generator
+//
+// Compiles the AI personalities in ai_player.h into the lookup tables the
+// game runs (src/ai_policy.h). A personality's behavior function only looks
+// at the distance to the opponent, what the opponent is doing
+// (aiOpponentClass()), whether it can punch itself and which side the
+// opponent is on. This tool calls every behavior function across that space
+// with many RNG seeds, merges distances that decide alike into buckets, and
+// writes each situation's moves with their odds and hold times.
+//
+//   pio run -e native_policy
+//   .pio/build/native_policy/program [output]
+//
+// output defaults to src/ai_policy.h. To change how a personality plays,
+// edit its behavior function and regenerate.
+//
+// Before writing anything it checks that the tables say everything the
+// functions do: every animation decides like its opponent class, both sides
+// of the arena decide alike, and distances beyond the table decide like its
+// last one.
+
+#define LOG_ENABLE_COMBAT 0
+#define LOG_ENABLE_AI 0
+#define LOG_ENABLE_INPUT 0
+#define LOG_ENABLE_STATE 0
+#define LOG_ENABLE_HASH 0
+
+#include "host_platform.h"
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+#include "../ai_player.h"
+
+#define TABLE_PERSONALITIES 4    // AI_AGGRESSIVE to AI_RANDOM - AI_EXPERT searches instead
+#define TABLE_MAX_DISTANCE 127   // Covers the 128 pixel arena
+#define CHECK_MAX_DISTANCE 255   // Distances past the table are checked up to here
+#define MAX_DURATION 64          // Longest hold a behavior function may ask for
+#define SWEEP_SAMPLES 4096       // Seeds per situation when comparing situations
+#define WEIGHT_SAMPLES 1000000   // Seeds per situation when measuring odds
+#define WEIGHT_TOLERANCE 0.25    // Percent a measured weight may be off a whole percent
+#define SPREAD_TOLERANCE 0.05    // Share a randomised hold time may be off uniform
+
+const char* personalityNames[TABLE_PERSONALITIES] = { "AGGRESSIVE", "DEFENSIVE", "BALANCED", "RANDOM" };
+
+const char* moveNames[AI_MOVE_COUNT] = {
+    "AI_MOVE_IDLE",
+    "AI_MOVE_FORWARD",
+    "AI_MOVE_BACK",
+    "AI_MOVE_PUNCH",
+    "AI_MOVE_LOW_PUNCH",
+    "AI_MOVE_SQUAT_LOW_PUNCH",
+    "AI_MOVE_BLOCK",
+    "AI_MOVE_SQUAT_BLOCK",
+    "AI_MOVE_SQUAT",
+};
+
+const char* classNames[AI_OPP_CLASS_COUNT] = { "neutral", "hit", "attacking", "squat attacking" };
+
+// The opponent each class is sampled with
+const uint8_t classAnimation[AI_OPP_CLASS_COUNT] = {
+    ANIMATION_STOPPED,
+    ANIMATION_STAGGER,
+    ANIMATION_PUNCHING_HIGH,
+    ANIMATION_SQUATPUNCHING_LOW,
+};
+const bool classIsHit[AI_OPP_CLASS_COUNT] = { false, true, false, false };
+
+// One decision to sample
+struct Situation {
+    AIPersonality personality;
+    uint8_t animation;    // Opponent's
+    bool isHit;           // Opponent's
+    bool canPunch;
+    int distance;
+    bool opponentLeft;
+};
+
+// How often each move was picked with each hold time
+typedef std::vector<long> Outcomes;  // [move * MAX_DURATION + duration]
+
+// The move buttons stand for, or -1
+int moveOf(uint32_t buttons, bool moveRight) {
+    for (int move = 0; move < AI_MOVE_COUNT; move++) {
+        if (aiMoveButtons(move, moveRight) == buttons) return move;
+    }
+    return -1;
+}
+
+// Call the personality's behavior function with seeds 1..samples
+// The same seeds every time, so situations that decide alike tally alike.
+bool sample(const Situation& s, long samples, Outcomes* out) {
+    Player self;
+    Player opponent;
+    memset(&self, 0, sizeof(Player));
+    memset(&opponent, 0, sizeof(Player));
+    self.playerNumber = 1;
+    opponent.playerNumber = 2;
+    self.canPunch = s.canPunch;
+    opponent.animation = s.animation;
+    opponent.isHit = s.isHit;
+    self.xPos = s.opponentLeft ? s.distance : 0;
+    opponent.xPos = s.opponentLeft ? 0 : s.distance;
+    bool moveRight = opponent.xPos > self.xPos;
+    Observation observation;
+    observe(&observation, &self, &opponent);
+
+    out->assign(AI_MOVE_COUNT * MAX_DURATION, 0);
+    for (long seed = 1; seed <= samples; seed++) {
+        AIController ai;
+        initAI(&ai, &self, &opponent, &observation, s.personality, (uint32_t)seed);
+
+        int duration = 1;
+        uint32_t buttons = ai_heuristic_behavior(&ai, s.distance, &duration);
+        int move = moveOf(buttons, moveRight);
+        if (move < 0 || duration < 0 || duration >= MAX_DURATION) {
+            fprintf(stderr, "%s picked buttons 0x%08X for %d ticks - not a move the tables can hold\n",
+                    personalityNames[s.personality], (unsigned)buttons, duration);
+            return false;
+        }
+        (*out)[move * MAX_DURATION + duration]++;
+    }
+    return true;
+}
+
+Situation classSituation(int personality, int opponentClass, bool canPunch, int distance) {
+    Situation s = { (AIPersonality)personality, classAnimation[opponentClass], classIsHit[opponentClass],
+                    canPunch, distance, false };
+    return s;
+}
+
+// Everything every personality does at one distance, and the checks that
+// the tables can stand in for it there
+bool sweepDistance(int distance, std::vector<Outcomes>* signature) {
+    signature->clear();
+    for (int p = 0; p < TABLE_PERSONALITIES; p++) {
+        for (int c = 0; c < AI_OPP_CLASS_COUNT; c++) {
+            for (int k = 0; k < 2; k++) {
+                Outcomes expected;
+                Situation s = classSituation(p, c, k, distance);
+                if (!sample(s, SWEEP_SAMPLES, &expected)) return false;
+                signature->push_back(expected);
+
+                Outcomes mirrored;
+                s.opponentLeft = true;
+                if (!sample(s, SWEEP_SAMPLES, &mirrored)) return false;
+                if (mirrored != expected) {
+                    fprintf(stderr, "%s decides differently with the opponent on the left at distance %d\n",
+                            personalityNames[p], distance);
+                    return false;
+                }
+            }
+        }
+
+        // Every opponent animation must decide like its class
+        for (int animation = 0; animation < ANIMATION_COUNT; animation++) {
+            for (int hit = 0; hit < 2; hit++) {
+                FighterView opponent;
+                memset(&opponent, 0, sizeof(FighterView));
+                opponent.flags = animations[animation].flags;
+                opponent.isHit = hit;
+                int c = aiOpponentClass(opponent);
+
+                for (int k = 0; k < 2; k++) {
+                    Situation s = { (AIPersonality)p, (uint8_t)animation, (bool)hit, (bool)k, distance, false };
+                    Outcomes outcomes;
+                    if (!sample(s, SWEEP_SAMPLES, &outcomes)) return false;
+                    if (outcomes != (*signature)[(p * AI_OPP_CLASS_COUNT + c) * 2 + k]) {
+                        fprintf(stderr, "%s treats animation %d (isHit %d) unlike the rest of class %s at distance %d\n",
+                                personalityNames[p], animation, hit, classNames[c], distance);
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// The choices one cell of the table holds
+struct Choice {
+    int move;
+    int weight;
+    int duration;
+    int durationSpread;
+};
+
+// Turn measured outcomes into weighted choices, most likely first
+bool measureChoices(const Outcomes& outcomes, long samples, std::vector<Choice>* choices) {
+    choices->clear();
+    int total = 0;
+    for (int move = 0; move < AI_MOVE_COUNT; move++) {
+        const long* counts = &outcomes[move * MAX_DURATION];
+        long picked = 0;
+        int first = -1;
+        int last = -1;
+        for (int d = 0; d < MAX_DURATION; d++) {
+            if (counts[d] == 0) continue;
+            picked += counts[d];
+            if (first < 0) first = d;
+            last = d;
+        }
+        if (picked == 0) continue;
+
+        // Hold times must be one fixed value or a uniform range
+        int spread = last - first + 1;
+        for (int d = first; d <= last; d++) {
+            double share = (double)counts[d] / picked;
+            if (fabs(share - 1.0 / spread) > SPREAD_TOLERANCE / spread) {
+                fprintf(stderr, "%s is held for %d-%d ticks, but not uniformly\n", moveNames[move], first, last);
+                return false;
+            }
+        }
+
+        double percent = 100.0 * picked / samples;
+        int weight = (int)lround(percent);
+        if (weight == 0 || fabs(percent - weight) > WEIGHT_TOLERANCE) {
+            fprintf(stderr, "%s is picked %.3f%% of the time - not a whole percent\n", moveNames[move], percent);
+            return false;
+        }
+
+        Choice c = { move, weight, first, spread };
+        choices->push_back(c);
+        total += weight;
+    }
+    if (total != 100) {
+        fprintf(stderr, "Choice weights add up to %d%%\n", total);
+        return false;
+    }
+
+    // Most likely first, so the weighted pick usually stops early
+    for (size_t i = 1; i < choices->size(); i++) {
+        for (size_t j = i; j > 0 && (*choices)[j].weight > (*choices)[j - 1].weight; j--) {
+            Choice swap = (*choices)[j];
+            (*choices)[j] = (*choices)[j - 1];
+            (*choices)[j - 1] = swap;
+        }
+    }
+    return true;
+}
+
+struct Policy {
+    std::vector<int> bucketStart;                     // First distance of each bucket
+    std::vector<std::vector<Choice> > cells;          // [personality][class][canPunch][bucket]
+
+    int bucketCount() const { return (int)bucketStart.size(); }
+    int bucketEnd(int b) const {
+        return b + 1 < bucketCount() ? bucketStart[b + 1] - 1 : TABLE_MAX_DISTANCE;
+    }
+    std::vector<Choice>& cell(int p, int c, int k, int b) {
+        return cells[((p * AI_OPP_CLASS_COUNT + c) * 2 + k) * bucketCount() + b];
+    }
+};
+
+bool buildPolicy(Policy* policy) {
+    // Bucket distances: a new bucket wherever any personality changes its mind
+    std::vector<Outcomes> previous;
+    std::vector<Outcomes> signature;
+    for (int distance = 0; distance <= CHECK_MAX_DISTANCE; distance++) {
+        if (!sweepDistance(distance, &signature)) return false;
+
+        if (distance == 0 || signature != previous) {
+            if (distance > TABLE_MAX_DISTANCE) {
+                fprintf(stderr, "Decisions still change at distance %d, past the table's %d\n",
+                        distance, TABLE_MAX_DISTANCE);
+                return false;
+            }
+            policy->bucketStart.push_back(distance);
+        }
+        previous.swap(signature);
+    }
+
+    // Measure each cell at its bucket's first distance
+    policy->cells.resize(TABLE_PERSONALITIES * AI_OPP_CLASS_COUNT * 2 * policy->bucketCount());
+    for (int p = 0; p < TABLE_PERSONALITIES; p++) {
+        for (int c = 0; c < AI_OPP_CLASS_COUNT; c++) {
+            for (int k = 0; k < 2; k++) {
+                for (int b = 0; b < policy->bucketCount(); b++) {
+                    Outcomes outcomes;
+                    if (!sample(classSituation(p, c, k, policy->bucketStart[b]), WEIGHT_SAMPLES, &outcomes) ||
+                        !measureChoices(outcomes, WEIGHT_SAMPLES, &policy->cell(p, c, k, b))) {
+                        fprintf(stderr, "  in %s, opponent %s, canPunch %d, distance %d-%d\n",
+                                personalityNames[p], classNames[c], k,
+                                policy->bucketStart[b], policy->bucketEnd(b));
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool writeHeader(const char* path, Policy& policy) {
+    FILE* f = fopen(path, "w");
+    if (f == nullptr) return false;
+
+    int choiceCount = 0;
+    for (size_t i = 0; i < policy.cells.size(); i++) choiceCount += (int)policy.cells[i].size();
+
+    fprintf(f, "#pragma once\n\n");
+    fprintf(f, "#include <stdint.h>\n");
+    fprintf(f, "#include <pgmspace.h>\n\n");
+    fprintf(f, "// Generated by  : src/host/gen_policy.cpp - do not edit by hand\n");
+    fprintf(f, "// Source        : the behavior functions in ai_player.h, %d seeds per situation\n",
+            WEIGHT_SAMPLES);
+    fprintf(f, "//\n");
+    fprintf(f, "// AI decision tables, indexed by personality, opponent class\n");
+    fprintf(f, "// (aiOpponentClass()), canPunch and distance bucket. Each cell lists its\n");
+    fprintf(f, "// moves, most likely first, with their odds in percent and hold times.\n\n");
+    fprintf(f, "#define POLICY_PERSONALITIES %d\n", TABLE_PERSONALITIES);
+    fprintf(f, "#define POLICY_DISTANCE_BUCKETS %d\n", policy.bucketCount());
+    fprintf(f, "#define POLICY_MAX_DISTANCE %d  // Further away decides like this\n\n", TABLE_MAX_DISTANCE);
+
+    fprintf(f, "// Buckets:");
+    for (int b = 0; b < policy.bucketCount(); b++) {
+        fprintf(f, " %d-%d%s", policy.bucketStart[b], policy.bucketEnd(b), b + 1 < policy.bucketCount() ? "," : "\n");
+    }
+    fprintf(f, "constexpr uint8_t policy_distance_bucket[POLICY_MAX_DISTANCE + 1] PROGMEM = {\n");
+    for (int d = 0, b = 0; d <= TABLE_MAX_DISTANCE; d++) {
+        if (b + 1 < policy.bucketCount() && d == policy.bucketStart[b + 1]) b++;
+        fprintf(f, "%d,%s", b, (d % 16 == 15 || d == TABLE_MAX_DISTANCE) ? "\n" : " ");
+    }
+    fprintf(f, "};\n\n");
+
+    // { move, weight, duration, durationSpread }
+    fprintf(f, "constexpr PolicyChoice policy_choices[%d] PROGMEM = {\n", choiceCount);
+    for (int p = 0; p < TABLE_PERSONALITIES; p++) {
+        for (int c = 0; c < AI_OPP_CLASS_COUNT; c++) {
+            for (int k = 0; k < 2; k++) {
+                for (int b = 0; b < policy.bucketCount(); b++) {
+                    fprintf(f, "    // %s, opponent %s, %s, distance %d-%d\n",
+                            personalityNames[p], classNames[c], k ? "can punch" : "can't punch",
+                            policy.bucketStart[b], policy.bucketEnd(b));
+                    const std::vector<Choice>& cell = policy.cell(p, c, k, b);
+                    for (size_t i = 0; i < cell.size(); i++) {
+                        fprintf(f, "    { %s, %d, %d, %d },\n", moveNames[cell[i].move],
+                                cell[i].weight, cell[i].duration, cell[i].durationSpread);
+                    }
+                }
+            }
+        }
+    }
+    fprintf(f, "};\n\n");
+
+    // { first, count }
+    fprintf(f, "constexpr PolicyCell policy_cells[POLICY_PERSONALITIES][%d][2][POLICY_DISTANCE_BUCKETS] PROGMEM = {\n",
+            AI_OPP_CLASS_COUNT);
+    int first = 0;
+    for (int p = 0; p < TABLE_PERSONALITIES; p++) {
+        fprintf(f, "    {  // %s\n", personalityNames[p]);
+        for (int c = 0; c < AI_OPP_CLASS_COUNT; c++) {
+            fprintf(f, "        {  // Opponent %s\n", classNames[c]);
+            for (int k = 0; k < 2; k++) {
+                fprintf(f, "            {");
+                for (int b = 0; b < policy.bucketCount(); b++) {
+                    int count = (int)policy.cell(p, c, k, b).size();
+                    fprintf(f, " { %d, %d }%s", first, count, b + 1 < policy.bucketCount() ? "," : "");
+                    first += count;
+                }
+                fprintf(f, " },%s\n", k ? "" : "  // Can't punch");
+            }
+            fprintf(f, "        },\n");
+        }
+        fprintf(f, "    },\n");
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* output = argc > 1 ? argv[1] : "src/ai_policy.h";
+
+    Policy policy;
+    if (!buildPolicy(&policy)) return 1;
+    if (!writeHeader(output, policy)) {
+        fprintf(stderr, "Could not write %s\n", output);
+        return 1;
+    }
+
+    int choiceCount = 0;
+    for (size_t i = 0; i < policy.cells.size(); i++) choiceCount += (int)policy.cells[i].size();
+    printf("%d distance buckets, %d cells, %d choices -> %s\n",
+           policy.bucketCount(), (int)policy.cells.size(), choiceCount, output);
+    return 0;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <chrono>
+#include <thread>
+#include "pgmspace.h"
+
+// Host stand-ins for the Arduino core, enough to compile the game headers
+// natively. Include before anything from src/.
+
+#define HIGH 1
+#define LOW 0
+
+// Serial output is discarded unless echo is turned on
+class HostSerial {
+public:
+    bool echo = false;
+
+    void begin(unsigned long) {}
+    void flush() { if (echo) fflush(stdout); }
+
+    void print(const char* s) { if (echo) fputs(s, stdout); }
+    void print(int v) { if (echo) printf("%d", v); }
+    void println(const char* s = "") { if (echo) puts(s); }
+    void println(int v) { if (echo) printf("%d\n", v); }
+
+    void printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        if (!echo) return;
+        va_list args;
+        va_start(args, format);
+        vprintf(format, args);
+        va_end(args);
+    }
+};
+
+HostSerial Serial;
+
+inline int64_t hostNowMicros() {
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+inline unsigned long millis() { return (unsigned long)(hostNowMicros() / 1000); }
+inline unsigned long micros() { return (unsigned long)hostNowMicros(); }
+inline int64_t esp_timer_get_time() { return hostNowMicros(); }
+inline void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline int digitalRead(uint8_t) { return HIGH; }
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+// Host stand-in for the ESP32 <pgmspace.h> - flash data is ordinary memory here
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
@@ -0,0 +1,90 @@
+// Recording replayer
+//
+// Replays a match recorded by the device (a /rec/NNNNN.hrc file, see
+// input_recorder.h) through the native simulation and prints the state hash
+// of every tick, in the same format tools/decode_log.py gives EV_STATE_HASH
+// records. Replaying the same file on the device (SELECT on the menu) must
+// give the same stream, so the first differing line is the first tick where
+// host and device disagree:
+//
+//   pio run -e native_replay
+//   .pio/build/native_replay/program 00042.hrc > host.txt
+//   python3 tools/decode_log.py capture.bin | grep "State hash" > device.txt
+//   diff host.txt device.txt | head
+//
+// --final prints only the last tick, which covers every tick before it.
+
+#define LOG_ENABLE_COMBAT 0
+#define LOG_ENABLE_AI 0
+#define LOG_ENABLE_INPUT 0
+#define LOG_ENABLE_STATE 0
+#define LOG_ENABLE_HASH 0
+
+#include "host_platform.h"
+#include <string.h>
+#include <vector>
+
+#include "../simulation.h"
+#include "../input_record.h"
+
+#define ARENA_WIDTH 128
+#define ARENA_HEIGHT 64
+
+bool readRecording(const char* path, std::vector<uint8_t>* stream) {
+    FILE* f = fopen(path, "rb");
+    if (f == nullptr) return false;
+
+    uint8_t header[RECORD_HEADER_SIZE];
+    bool ok = fread(header, 1, RECORD_HEADER_SIZE, f) == RECORD_HEADER_SIZE &&
+              (header[0] | header[1] << 8 | header[2] << 16 | (uint32_t)header[3] << 24) == RECORD_MAGIC;
+
+    uint8_t buffer[4096];
+    size_t n;
+    while (ok && (n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+        stream->insert(stream->end(), buffer, buffer + n);
+    }
+    fclose(f);
+    return ok;
+}
+
+void printHash(const GameState& gs) {
+    printf("[%7u] State hash %08X%08X\n", (unsigned)gs.tick,
+           (unsigned)(gs.stateHash >> 32), (unsigned)gs.stateHash);
+}
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    bool finalOnly = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--final") == 0) {
+            finalOnly = true;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (path == nullptr) {
+        fprintf(stderr, "Usage: %s RECORDING.hrc [--final]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<uint8_t> stream;
+    if (!readRecording(path, &stream) || stream.empty()) {
+        fprintf(stderr, "%s is not a recording\n", path);
+        return 1;
+    }
+
+    // The device starts every playback the same way, see playbackTick()
+    GameState gs;
+    gameInit(gs, ARENA_WIDTH, ARENA_HEIGHT, RECORD_PLAYBACK_SEED);
+
+    InputDecoder decoder;
+    inputDecoderInit(&decoder, &stream[0], stream.size());
+    InputFrame frame;
+    while (inputDecode(&decoder, &frame)) {
+        step(gs, tickInputsFromFrame(frame));
+        if (!finalOnly) printHash(gs);
+    }
+    if (finalOnly) printHash(gs);
+    return 0;
+}
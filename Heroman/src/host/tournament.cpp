@@ -0,0 +1,231 @@
+// Headless AI tournament
+//
+// Plays seeded CPU vs CPU matches for every pairing of AI personalities and
+// reports win rates, match length, hits landed and squat dodges, so AI
+// changes can be balanced without watching the attract mode. Matches run the
+// real simulation through step(), the same code the device runs, spread over
+// a pool of worker threads.
+//
+//   pio run -e native_tournament
+//   .pio/build/native_tournament/program [matches] [--threads N] [--seed S]
+//
+// matches is per pairing. Every match is seeded from --seed and its own
+// number, so results do not depend on the thread count.
+
+// Nothing drains the event log here, and with logging compiled out the
+// simulation shares no state between threads
+#define LOG_ENABLE_COMBAT 0
+#define LOG_ENABLE_AI 0
+#define LOG_ENABLE_INPUT 0
+#define LOG_ENABLE_STATE 0
+#define LOG_ENABLE_HASH 0
+
+// Nor is anything comparing runs, so skip the per-tick state hash
+#define STATE_HASH_ENABLE 0
+
+#include "host_platform.h"
+#include <string.h>
+#include <vector>
+
+#include "../simulation.h"
+#include "../ai_expert.h"
+#include "work_pool.h"
+
+#define ARENA_WIDTH 128
+#define ARENA_HEIGHT 64
+#define MATCH_TICK_LIMIT (25 * 60 * 5)  // Five minutes of fighting, then it is a draw
+#define MATCH_BATCH 64                  // Matches in one job of the work pool
+
+#define PERSONALITY_COUNT 6
+#define PAIRING_COUNT (PERSONALITY_COUNT * PERSONALITY_COUNT)
+
+const char* personalityNames[PERSONALITY_COUNT] = {
+    "AGGRESSIVE",
+    "DEFENSIVE",
+    "BALANCED",
+    "RANDOM",
+    "EXPERT",
+    "NEURAL",
+};
+
+struct MatchResult {
+    int winner;          // 0 or 1, -1 for a draw
+    int ticks;           // Ticks spent in GAME_PLAYING
+    int hitsLanded[2];
+    int squatDodges[2];
+};
+
+struct MatchupStats {
+    long matches;
+    long wins[2];
+    long draws;
+    int64_t ticks;
+    int64_t hitsLanded[2];
+    int64_t squatDodges[2];
+};
+
+// Spread the run seed and match number over all 32 bits
+uint32_t matchSeed(uint32_t seed, long match) {
+    uint32_t x = seed ^ ((uint32_t)match * 0x9E3779B9u);
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+    return x;
+}
+
+MatchResult playMatch(AIPersonality p1, AIPersonality p2, uint32_t seed) {
+    GameState gs;
+    gameInit(gs, ARENA_WIDTH, ARENA_HEIGHT, seed);
+    gs.aiPlayer1.personality = p1;
+    gs.aiPlayer2.personality = p2;
+
+    // No gamepads, so both fighters stay on AI once the match starts
+    TickInputs in = {};
+    in.buttons[0] = CTRL_STATE_IDLE;
+    in.buttons[1] = CTRL_STATE_IDLE;
+    in.startPressed = true;
+    step(gs, in);
+    in.startPressed = false;
+
+    while (gs.gameState == GAME_COUNTDOWN) {
+        step(gs, in);
+    }
+
+    MatchResult result;
+    result.ticks = 0;
+    while (gs.gameState == GAME_PLAYING && result.ticks < MATCH_TICK_LIMIT) {
+        lookaheadThink(gs, in);  // AI_EXPERT, on a node budget so matches stay reproducible
+        step(gs, in);
+        result.ticks++;
+    }
+
+    result.winner = (gs.winner != nullptr) ? gs.winner->playerNumber - 1 : -1;
+    for (int i = 0; i < 2; i++) {
+        result.hitsLanded[i] = gs.hitsLanded[i];
+        result.squatDodges[i] = gs.squatDodges[i];
+    }
+    return result;
+}
+
+void addResult(MatchupStats* stats, const MatchResult& r) {
+    stats->matches++;
+    if (r.winner < 0) {
+        stats->draws++;
+    } else {
+        stats->wins[r.winner]++;
+    }
+    stats->ticks += r.ticks;
+    for (int i = 0; i < 2; i++) {
+        stats->hitsLanded[i] += r.hitsLanded[i];
+        stats->squatDodges[i] += r.squatDodges[i];
+    }
+}
+
+void addStats(MatchupStats* total, const MatchupStats& s) {
+    total->matches += s.matches;
+    total->draws += s.draws;
+    total->ticks += s.ticks;
+    for (int i = 0; i < 2; i++) {
+        total->wins[i] += s.wins[i];
+        total->hitsLanded[i] += s.hitsLanded[i];
+        total->squatDodges[i] += s.squatDodges[i];
+    }
+}
+
+// Work shared by the pool: match numbers 0 .. PAIRING_COUNT * matchesPerPairing - 1
+// One job: a batch of matches from a single pairing, with its own totals so
+// the workers share nothing but the pool. Batches are numbered pairing by
+// pairing.
+void runBatch(long matchesPerPairing, uint32_t seed, long batch, MatchupStats* stats) {
+    long batchesPerPairing = (matchesPerPairing + MATCH_BATCH - 1) / MATCH_BATCH;
+    int pairing = (int)(batch / batchesPerPairing);
+    long first = (batch % batchesPerPairing) * MATCH_BATCH;
+    long last = first + MATCH_BATCH < matchesPerPairing ? first + MATCH_BATCH : matchesPerPairing;
+    AIPersonality p1 = (AIPersonality)(pairing / PERSONALITY_COUNT);
+    AIPersonality p2 = (AIPersonality)(pairing % PERSONALITY_COUNT);
+
+    memset(stats, 0, sizeof(MatchupStats));
+    for (long match = first; match < last; match++) {
+        addResult(stats, playMatch(p1, p2, matchSeed(seed, pairing * matchesPerPairing + match)));
+    }
+}
+
+double percent(long part, long whole) {
+    return whole > 0 ? 100.0 * part / whole : 0.0;
+}
+
+double average(int64_t total, long count) {
+    return count > 0 ? (double)total / count : 0.0;
+}
+
+int main(int argc, char** argv) {
+    long matches = 10000;
+    int threads = (int)std::thread::hardware_concurrency();
+    uint32_t seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else {
+            matches = atol(argv[i]);
+        }
+    }
+    if (matches < 1) matches = 1;
+    if (threads < 1) threads = 1;
+
+    long batchesPerPairing = (matches + MATCH_BATCH - 1) / MATCH_BATCH;
+    std::vector<MatchupStats> batchStats(batchesPerPairing * PAIRING_COUNT);
+
+    auto start = std::chrono::steady_clock::now();
+    workPoolRun(threads, (long)batchStats.size(), [&](long batch) {
+        runBatch(matches, seed, batch, &batchStats[batch]);
+    });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    MatchupStats pairings[PAIRING_COUNT];
+    memset(pairings, 0, sizeof(pairings));
+    int64_t totalTicks = 0;
+    for (size_t b = 0; b < batchStats.size(); b++) {
+        addStats(&pairings[b / batchesPerPairing], batchStats[b]);
+    }
+    for (int p = 0; p < PAIRING_COUNT; p++) {
+        totalTicks += pairings[p].ticks;
+    }
+
+    long totalMatches = matches * PAIRING_COUNT;
+    printf("%ld matches (%ld per pairing, seed %u) on %d threads in %.2f s: %.0f matches/s, %.1fM ticks/s\n",
+           totalMatches, matches, seed, threads, seconds, totalMatches / seconds, totalTicks / seconds / 1e6);
+    printf("\n%-10s    %-10s  %6s %6s %6s  %8s  %13s  %13s\n",
+           "P1", "P2", "P1 win", "P2 win", "draw", "length", "hits P1/P2", "dodges P1/P2");
+
+    for (int p = 0; p < PAIRING_COUNT; p++) {
+        const MatchupStats& s = pairings[p];
+        printf("%-10s vs %-10s  %5.1f%% %5.1f%% %5.1f%%  %7.1fs  %6.1f/%-6.1f  %6.2f/%-6.2f\n",
+               personalityNames[p / PERSONALITY_COUNT], personalityNames[p % PERSONALITY_COUNT],
+               percent(s.wins[0], s.matches), percent(s.wins[1], s.matches), percent(s.draws, s.matches),
+               average(s.ticks, s.matches) / 25.0,
+               average(s.hitsLanded[0], s.matches), average(s.hitsLanded[1], s.matches),
+               average(s.squatDodges[0], s.matches), average(s.squatDodges[1], s.matches));
+    }
+
+    // Overall strength, playing either side against every personality
+    printf("\n%-10s  %6s  %6s\n", "AI", "win", "draw");
+    for (int a = 0; a < PERSONALITY_COUNT; a++) {
+        long played = 0;
+        long wins = 0;
+        long draws = 0;
+        for (int b = 0; b < PERSONALITY_COUNT; b++) {
+            const MatchupStats& asP1 = pairings[a * PERSONALITY_COUNT + b];
+            const MatchupStats& asP2 = pairings[b * PERSONALITY_COUNT + a];
+            played += asP1.matches + asP2.matches;
+            wins += asP1.wins[0] + asP2.wins[1];
+            draws += asP1.draws + asP2.draws;
+        }
+        printf("%-10s  %5.1f%%  %5.1f%%\n", personalityNames[a], percent(wins, played), percent(draws, played));
+    }
+    return 0;
+}
@@ -0,0 +1,385 @@
+// Self-play trainer for the AI_NEURAL policy network
+//
+// Trains the network in ai_neural.h with evolution strategies. Each
+// generation perturbs the weights in many random directions, plays every
+// perturbed network through real matches (step(), the code the device runs)
+// and moves the weights toward the directions that did best. Opponents are
+// the heuristic personalities, AI_EXPERT and earlier snapshots of the
+// network itself, so it cannot settle on a trick that beats only one style.
+//
+// Every match runs the int8 network exactly as the device will, so what is
+// trained is what ships.
+//
+//   pio run -e native_train
+//   .pio/build/native_train/program [output] [--generations N] [--threads N] [--seed S]
+//
+// output defaults to src/ai_neural_weights.h. Training is reproducible from
+// the seed whatever the thread count.
+
+#define LOG_ENABLE_COMBAT 0
+#define LOG_ENABLE_AI 0
+#define LOG_ENABLE_INPUT 0
+#define LOG_ENABLE_STATE 0
+#define LOG_ENABLE_HASH 0
+#define STATE_HASH_ENABLE 0
+
+#include "host_platform.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "../simulation.h"
+#include "../ai_expert.h"
+#include "work_pool.h"
+
+#define ARENA_WIDTH 128
+#define ARENA_HEIGHT 64
+#define TRAIN_TICK_LIMIT (25 * 60)   // A minute of fighting, then it is a draw
+#define TRAIN_PAIRS 24               // Mirrored perturbations per generation
+#define TRAIN_MATCHES 12             // Matches per perturbation, the same for all of them
+#define TRAIN_SIGMA 0.08f            // Size of a perturbation
+#define TRAIN_RATE 0.02f             // Adam step size
+#define TRAIN_DECAY 0.002f           // Pull toward zero each step, keeps int8 scales fine
+#define SNAPSHOT_INTERVAL 25         // Generations between self-play snapshots
+#define SNAPSHOT_COUNT 6             // Snapshots kept as opponents
+#define REPORT_INTERVAL 10           // Generations between progress lines
+#define FINAL_MATCHES 200            // Per opponent and side, for the report
+
+// One hidden-layer width everywhere, as ai_neural.h lays it out
+const int layerOutputs[NEURAL_LAYERS] = { NEURAL_WIDTH, NEURAL_WIDTH, NEURAL_OUTPUTS };
+
+int parameterCount() {
+    int n = 0;
+    for (int l = 0; l < NEURAL_LAYERS; l++) n += layerOutputs[l] * (NEURAL_WIDTH + 1);
+    return n;
+}
+
+// Float weights quantized into the layout the kernel reads
+// Holds pointers into itself - build with quantize() and do not copy.
+struct QuantizedNet {
+    int8_t weights[NEURAL_LAYERS][NEURAL_WIDTH * NEURAL_WIDTH];
+    int32_t bias[NEURAL_LAYERS][NEURAL_WIDTH];
+    NeuralNet net;
+
+    QuantizedNet() {}
+    QuantizedNet(const QuantizedNet&) = delete;
+    QuantizedNet& operator=(const QuantizedNet&) = delete;
+};
+
+// Parameters are, per layer, the weights row by row and then the biases
+void quantize(const float* params, QuantizedNet* q) {
+    for (int l = 0; l < NEURAL_LAYERS; l++) {
+        int outputs = layerOutputs[l];
+        const float* w = params;
+        const float* b = params + outputs * NEURAL_WIDTH;
+        params = b + outputs;
+
+        // Largest scale that keeps every weight within int8
+        float largest = 0;
+        for (int i = 0; i < outputs * NEURAL_WIDTH; i++) largest = std::max(largest, fabsf(w[i]));
+        int shift = 0;
+        while (shift < 14 && largest * (1 << (shift + 1)) <= 127.0f) shift++;
+
+        for (int i = 0; i < outputs * NEURAL_WIDTH; i++) {
+            long v = lroundf(w[i] * (1 << shift));
+            q->weights[l][i] = (int8_t)std::max(-127L, std::min(127L, v));
+        }
+        for (int o = 0; o < outputs; o++) {
+            q->bias[l][o] = (int32_t)lroundf(b[o] * (float)(1 << (shift + 7)));
+        }
+        q->net.layers[l].weights = q->weights[l];
+        q->net.layers[l].bias = q->bias[l];
+        q->net.layers[l].outputs = (uint8_t)outputs;
+        q->net.layers[l].shift = (uint8_t)shift;
+    }
+}
+
+// Who the network plays: a personality, or a network of its own
+struct Opponent {
+    AIPersonality personality;
+    const NeuralNet* net;  // For AI_NEURAL
+};
+
+const char* opponentName(const Opponent& o) {
+    static const char* names[] = { "AGGRESSIVE", "DEFENSIVE", "BALANCED", "RANDOM", "EXPERT", "SNAPSHOT" };
+    return names[o.personality];
+}
+
+struct MatchOutcome {
+    int result;     // 1 won, -1 lost, 0 draw
+    int health[2];  // Network's, opponent's
+    int ticks;
+};
+
+MatchOutcome playMatch(const NeuralNet* net, const Opponent& opponent, bool netIsP1, uint32_t seed) {
+    GameState gs;
+    gameInit(gs, ARENA_WIDTH, ARENA_HEIGHT, seed);
+    AIController* mine = netIsP1 ? &gs.aiPlayer1 : &gs.aiPlayer2;
+    AIController* theirs = netIsP1 ? &gs.aiPlayer2 : &gs.aiPlayer1;
+    mine->personality = AI_NEURAL;
+    mine->net = net;
+    theirs->personality = opponent.personality;
+    if (opponent.personality == AI_NEURAL) theirs->net = opponent.net;
+
+    TickInputs in = {};
+    in.buttons[0] = CTRL_STATE_IDLE;
+    in.buttons[1] = CTRL_STATE_IDLE;
+    in.startPressed = true;
+    step(gs, in);
+    in.startPressed = false;
+    while (gs.gameState == GAME_COUNTDOWN) {
+        step(gs, in);
+    }
+
+    MatchOutcome m;
+    m.ticks = 0;
+    while (gs.gameState == GAME_PLAYING && m.ticks < TRAIN_TICK_LIMIT) {
+        lookaheadThink(gs, in);
+        step(gs, in);
+        m.ticks++;
+    }
+
+    Player* me = netIsP1 ? &gs.player1 : &gs.player2;
+    Player* them = netIsP1 ? &gs.player2 : &gs.player1;
+    m.result = gs.winner == me ? 1 : (gs.winner == them ? -1 : 0);
+    m.health[0] = me->health;
+    m.health[1] = them->health;
+    return m;
+}
+
+// Win or lose, then health difference; a draw costs a little so stalling
+// never looks safe
+float fitness(const MatchOutcome& m) {
+    float f = (float)m.result + (m.health[0] - m.health[1]) / 200.0f;
+    if (m.result == 0) f -= 0.25f;
+    if (m.result > 0) f += 0.25f * (1.0f - (float)m.ticks / TRAIN_TICK_LIMIT);  // Sooner is better
+    return f;
+}
+
+// Small deterministic generator for the perturbations
+struct TrainRandom {
+    uint64_t state;
+
+    uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return (uint32_t)(state >> 32);
+    }
+    float uniform() { return (next() + 0.5f) / 4294967296.0f; }
+    float gaussian() {
+        return sqrtf(-2.0f * logf(uniform())) * cosf(6.2831853f * uniform());
+    }
+};
+
+uint32_t trainSeed(uint32_t seed, long a, long b) {
+    uint32_t x = seed ^ ((uint32_t)a * 0x9E3779B9u) ^ ((uint32_t)b * 0x85EBCA6Bu);
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// One generation's matches, one job per candidate and match
+struct Generation {
+    std::vector<QuantizedNet*> nets;        // 2 * TRAIN_PAIRS candidates
+    std::vector<Opponent> opponents;        // [match]
+    std::vector<uint32_t> seeds;            // [match]
+    std::vector<float> scores;              // [candidate * TRAIN_MATCHES + match]
+};
+
+void playGenerationMatch(Generation* g, long job) {
+    int candidate = (int)(job / TRAIN_MATCHES);
+    int match = (int)(job % TRAIN_MATCHES);
+    MatchOutcome m = playMatch(&g->nets[candidate]->net, g->opponents[match], match % 2 == 0, g->seeds[match]);
+    g->scores[job] = fitness(m);
+}
+
+bool writeHeader(const char* path, const QuantizedNet& q, int generations, uint32_t seed,
+                 const char* results) {
+    FILE* f = fopen(path, "w");
+    if (f == nullptr) return false;
+
+    fprintf(f, "#pragma once\n\n");
+    fprintf(f, "#include <stdint.h>\n");
+    fprintf(f, "#include <pgmspace.h>\n\n");
+    fprintf(f, "// Generated by  : src/host/train_neural.cpp - do not edit by hand\n");
+    fprintf(f, "// Training      : %d generations of self-play, seed %u\n", generations, (unsigned)seed);
+    fprintf(f, "// Win/loss      : %s\n", results);
+    fprintf(f, "//\n");
+    fprintf(f, "// Int8 weights of the AI_NEURAL policy network - see ai_neural.h for the format.\n\n");
+
+    const char* outputNames[NEURAL_LAYERS] = { "NEURAL_WIDTH", "NEURAL_WIDTH", "NEURAL_OUTPUTS" };
+    for (int l = 0; l < NEURAL_LAYERS; l++) {
+        int outputs = q.net.layers[l].outputs;
+        fprintf(f, "constexpr int8_t neural_weights_%d[%s * NEURAL_WIDTH] PROGMEM = {\n", l, outputNames[l]);
+        for (int o = 0; o < outputs; o++) {
+            fprintf(f, "   ");
+            for (int i = 0; i < NEURAL_WIDTH; i++) fprintf(f, " %4d,", q.weights[l][o * NEURAL_WIDTH + i]);
+            fprintf(f, "\n");
+        }
+        fprintf(f, "};\n");
+        fprintf(f, "constexpr int32_t neural_bias_%d[%s] PROGMEM = {\n   ", l, outputNames[l]);
+        for (int o = 0; o < outputs; o++) fprintf(f, " %d,", q.bias[l][o]);
+        fprintf(f, "\n};\n\n");
+    }
+
+    fprintf(f, "constexpr NeuralNet neural_net = { {\n");
+    for (int l = 0; l < NEURAL_LAYERS; l++) {
+        fprintf(f, "    { neural_weights_%d, neural_bias_%d, %s, %d },\n", l, l, outputNames[l], q.net.layers[l].shift);
+    }
+    fprintf(f, "} };\n");
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* output = "src/ai_neural_weights.h";
+    int generations = 600;
+    int threads = (int)std::thread::hardware_concurrency();
+    uint32_t seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--generations") == 0 && i + 1 < argc) {
+            generations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else {
+            output = argv[i];
+        }
+    }
+    if (threads < 1) threads = 1;
+
+    const int n = parameterCount();
+    TrainRandom rng = { ((uint64_t)seed << 32) | 0x2545F491u };
+
+    // Start small, about unit variance through each layer
+    std::vector<float> params(n);
+    for (int i = 0; i < n; i++) params[i] = rng.gaussian() * 0.25f;
+    std::vector<float> adamM(n, 0.0f);
+    std::vector<float> adamV(n, 0.0f);
+
+    std::vector<Opponent> pool;
+    for (int p = AI_AGGRESSIVE; p <= AI_EXPERT; p++) {
+        Opponent o = { (AIPersonality)p, nullptr };
+        pool.push_back(o);
+    }
+    std::vector<QuantizedNet*> snapshots;
+
+    std::vector<QuantizedNet*> candidates;
+    for (int c = 0; c < 2 * TRAIN_PAIRS; c++) candidates.push_back(new QuantizedNet);
+    std::vector<float> noise((size_t)TRAIN_PAIRS * n);
+    std::vector<float> candidate(n);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int gen = 1; gen <= generations; gen++) {
+        for (size_t i = 0; i < noise.size(); i++) noise[i] = rng.gaussian();
+        for (int pair = 0; pair < TRAIN_PAIRS; pair++) {
+            for (int sign = 0; sign < 2; sign++) {
+                for (int i = 0; i < n; i++) {
+                    float e = noise[(size_t)pair * n + i] * TRAIN_SIGMA;
+                    candidate[i] = params[i] + (sign ? -e : e);
+                }
+                quantize(&candidate[0], candidates[2 * pair + sign]);
+            }
+        }
+
+        // Every candidate plays the same matches; opponents rotate through the pool
+        Generation g;
+        g.nets = candidates;
+        for (int m = 0; m < TRAIN_MATCHES; m++) {
+            size_t all = pool.size() + snapshots.size();
+            size_t pick = ((size_t)gen * TRAIN_MATCHES / 2 + m / 2) % all;
+            Opponent o = { AI_NEURAL, nullptr };
+            if (pick < pool.size()) {
+                o = pool[pick];
+            } else {
+                o.net = &snapshots[pick - pool.size()]->net;
+            }
+            g.opponents.push_back(o);
+            g.seeds.push_back(trainSeed(seed, gen, m / 2));  // Both sides of the same fight
+        }
+        g.scores.assign(candidates.size() * TRAIN_MATCHES, 0.0f);
+        workPoolRun(threads, (long)g.scores.size(), [&g](long job) { playGenerationMatch(&g, job); });
+
+        // Rank the candidates, then step along the rank-weighted noise
+        std::vector<float> totals(candidates.size(), 0.0f);
+        for (size_t c = 0; c < candidates.size(); c++) {
+            for (int m = 0; m < TRAIN_MATCHES; m++) totals[c] += g.scores[c * TRAIN_MATCHES + m];
+        }
+        std::vector<int> order(candidates.size());
+        for (size_t c = 0; c < order.size(); c++) order[c] = (int)c;
+        std::stable_sort(order.begin(), order.end(), [&totals](int a, int b) { return totals[a] < totals[b]; });
+        std::vector<float> rank(candidates.size());
+        for (size_t r = 0; r < order.size(); r++) rank[order[r]] = (float)r / (order.size() - 1) - 0.5f;
+
+        for (int i = 0; i < n; i++) {
+            float grad = 0;
+            for (int pair = 0; pair < TRAIN_PAIRS; pair++) {
+                grad += (rank[2 * pair] - rank[2 * pair + 1]) * noise[(size_t)pair * n + i];
+            }
+            grad = grad / (TRAIN_PAIRS * TRAIN_SIGMA) - TRAIN_DECAY * params[i];
+
+            // Adam, ascending
+            adamM[i] = 0.9f * adamM[i] + 0.1f * grad;
+            adamV[i] = 0.999f * adamV[i] + 0.001f * grad * grad;
+            float mHat = adamM[i] / (1.0f - powf(0.9f, (float)gen));
+            float vHat = adamV[i] / (1.0f - powf(0.999f, (float)gen));
+            params[i] += TRAIN_RATE * mHat / (sqrtf(vHat) + 1e-8f);
+        }
+
+        if (gen % SNAPSHOT_INTERVAL == 0) {
+            QuantizedNet* snapshot;
+            if ((int)snapshots.size() < SNAPSHOT_COUNT) {
+                snapshot = new QuantizedNet;
+                snapshots.push_back(snapshot);
+            } else {
+                snapshot = snapshots[(gen / SNAPSHOT_INTERVAL) % SNAPSHOT_COUNT];
+            }
+            quantize(&params[0], snapshot);
+        }
+
+        if (gen % REPORT_INTERVAL == 0 || gen == generations) {
+            float mean = 0;
+            for (size_t c = 0; c < totals.size(); c++) mean += totals[c];
+            mean /= totals.size() * TRAIN_MATCHES;
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            printf("generation %4d: mean fitness %+.3f, %d snapshots, %.0f s\n",
+                   gen, mean, (int)snapshots.size(), seconds);
+            fflush(stdout);
+        }
+    }
+
+    QuantizedNet trained;
+    quantize(&params[0], &trained);
+
+    // Report against every personality, playing both sides
+    char results[256] = "";
+    for (size_t p = 0; p < pool.size(); p++) {
+        std::vector<int> outcomes(2 * FINAL_MATCHES);  // 1 won, -1 lost, 0 draw
+        const Opponent* opponent = &pool[p];
+        workPoolRun(threads, (long)outcomes.size(), [&](long match) {
+            outcomes[match] = playMatch(&trained.net, *opponent, match % 2 == 0, trainSeed(seed, -1, match)).result;
+        });
+        long wins = std::count(outcomes.begin(), outcomes.end(), 1);
+        long losses = std::count(outcomes.begin(), outcomes.end(), -1);
+
+        char line[64];
+        snprintf(line, sizeof(line), "%s%s %.0f%%/%.0f%%", p ? ", " : "", opponentName(pool[p]),
+                 100.0 * wins / (2 * FINAL_MATCHES), 100.0 * losses / (2 * FINAL_MATCHES));
+        strncat(results, line, sizeof(results) - strlen(results) - 1);
+    }
+    printf("Against: %s\n", results);
+
+    if (!writeHeader(output, trained, generations, seed, results)) {
+        fprintf(stderr, "Could not write %s\n", output);
+        return 1;
+    }
+    printf("%d parameters -> %s\n", n, output);
+    return 0;
+}
@@ -0,0 +1,396 @@
+// Genetic tuner for the heuristic AI personalities
+//
+// Evolves the AIParams of the heuristic personalities (AI_PARAMS in
+// ai_player.h) through headless matches against a fixed opponent and writes
+// the best sets back to src/ai_presets.h. Every candidate in a generation
+// plays the same seeded matches, spread over a work-stealing thread pool
+// (work_pool.h); the fittest carry over and breed the next generation.
+//
+//   pio run -e native_tune
+//   .pio/build/native_tune/program [output] [--personality NAME] [--against NAME]
+//       [--target balance|length|wins] [--generations N] [--population N]
+//       [--matches N] [--threads N] [--seed S]
+//
+// Targets:
+//   balance  win rate as close to 50% as possible - a fair fight
+//   length   longest knockouts; a draw counts as no fight at all
+//   wins     highest win rate
+//
+// --personality may be given more than once and defaults to all four
+// heuristic personalities; --against defaults to BALANCED as it plays now.
+// output defaults to src/ai_presets.h. A tuned set is written only if it
+// beats the current preset on a fresh set of matches. Runs are reproducible
+// from the seed whatever the thread count. The game plays the policy tables,
+// so rebuild them with native_policy afterwards.
+
+#define LOG_ENABLE_COMBAT 0
+#define LOG_ENABLE_AI 0
+#define LOG_ENABLE_INPUT 0
+#define LOG_ENABLE_STATE 0
+#define LOG_ENABLE_HASH 0
+#define STATE_HASH_ENABLE 0
+
+#include "host_platform.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "../simulation.h"
+#include "../ai_expert.h"
+#include "work_pool.h"
+
+#define ARENA_WIDTH 128
+#define ARENA_HEIGHT 64
+#define MATCH_TICK_LIMIT (25 * 120)  // Two minutes of fighting, then it is a draw
+#define ELITE_COUNT 4                // Best candidates carried over unchanged
+#define SELECT_ROUNDS 3              // Tournament size when picking a parent
+#define MUTATION_CHANCE 25           // Percent of fields changed in a child
+#define MUTATION_SCALE 0.1           // Typical change, as a share of the field's range
+#define VALIDATION_FACTOR 4          // Final check plays this many times the matches
+
+const char* personalityNames[] = { "AGGRESSIVE", "DEFENSIVE", "BALANCED", "RANDOM", "EXPERT", "NEURAL" };
+#define NAMED_PERSONALITIES 6
+
+enum Target { TARGET_BALANCE, TARGET_LENGTH, TARGET_WINS };
+const char* targetNames[] = { "balance", "length", "wins" };
+
+// Field table from AI_PARAMS, for walking an AIParams as an array of ints
+struct ParamField {
+    const char* name;
+    int min;
+    int max;
+    int users;  // AI_FOR() bits
+};
+
+#define AI_PARAM_ENTRY(name, min, max, users, meaning) { #name, min, max, users },
+const ParamField paramFields[] = {
+    AI_PARAMS(AI_PARAM_ENTRY)
+};
+#undef AI_PARAM_ENTRY
+#define PARAM_COUNT (int)(sizeof(paramFields) / sizeof(paramFields[0]))
+static_assert(sizeof(AIParams) == sizeof(int) * sizeof(paramFields) / sizeof(paramFields[0]),
+              "AIParams must be all ints, one per AI_PARAMS entry");
+
+inline int* paramValues(AIParams* p) { return reinterpret_cast<int*>(p); }
+inline const int* paramValues(const AIParams* p) { return reinterpret_cast<const int*>(p); }
+
+struct TuneRun {
+    AIPersonality against;
+    Target target;
+    int generations;
+    int population;
+    int matches;
+    int threads;
+    uint32_t seed;
+};
+
+// Spread the run seed, generation and match number over all 32 bits
+uint32_t tuneSeed(uint32_t seed, long generation, long match) {
+    uint32_t x = seed ^ ((uint32_t)generation * 0x9E3779B9u) ^ ((uint32_t)match * 0x85EBCA6Bu);
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+struct MatchResult {
+    int result;  // 1 the candidate won, -1 lost, 0 draw
+    int ticks;   // Ticks spent in GAME_PLAYING
+};
+
+MatchResult playMatch(AIPersonality personality, const AIParams* params, AIPersonality against,
+                      bool candidateIsP1, uint32_t seed) {
+    GameState gs;
+    gameInit(gs, ARENA_WIDTH, ARENA_HEIGHT, seed);
+    AIController* mine = candidateIsP1 ? &gs.aiPlayer1 : &gs.aiPlayer2;
+    AIController* theirs = candidateIsP1 ? &gs.aiPlayer2 : &gs.aiPlayer1;
+    mine->personality = personality;
+    mine->params = params;
+    theirs->personality = against;
+
+    TickInputs in = {};
+    in.buttons[0] = CTRL_STATE_IDLE;
+    in.buttons[1] = CTRL_STATE_IDLE;
+    in.startPressed = true;
+    step(gs, in);
+    in.startPressed = false;
+    while (gs.gameState == GAME_COUNTDOWN) {
+        step(gs, in);
+    }
+
+    MatchResult r;
+    r.ticks = 0;
+    while (gs.gameState == GAME_PLAYING && r.ticks < MATCH_TICK_LIMIT) {
+        lookaheadThink(gs, in);  // AI_EXPERT opponent, on a node budget
+        step(gs, in);
+        r.ticks++;
+    }
+
+    const Player* me = candidateIsP1 ? &gs.player1 : &gs.player2;
+    r.result = gs.winner == nullptr ? 0 : (gs.winner == me ? 1 : -1);
+    return r;
+}
+
+// Higher is better
+double fitness(Target target, const MatchResult* results, int count) {
+    double score = 0;
+    double knockoutSeconds = 0;
+    for (int i = 0; i < count; i++) {
+        score += results[i].result > 0 ? 1.0 : (results[i].result == 0 ? 0.5 : 0.0);
+        if (results[i].result != 0) knockoutSeconds += results[i].ticks / 25.0;
+    }
+    score /= count;
+
+    switch (target) {
+        case TARGET_BALANCE: return -fabs(score - 0.5);
+        case TARGET_LENGTH:  return knockoutSeconds / count;
+        default:             return score;
+    }
+}
+
+// Every candidate through the same matches: each seed is played from both sides
+void evaluate(const TuneRun& run, AIPersonality personality, const std::vector<AIParams>& candidates,
+              long generation, int matches, std::vector<double>* scores) {
+    long jobs = (long)candidates.size() * matches;
+    std::vector<MatchResult> results(jobs);
+    workPoolRun(run.threads, jobs, [&](long job) {
+        int candidate = (int)(job / matches);
+        int match = (int)(job % matches);
+        results[job] = playMatch(personality, &candidates[candidate], run.against, match % 2 == 0,
+                                 tuneSeed(run.seed, generation, match / 2));
+    });
+
+    scores->resize(candidates.size());
+    for (size_t c = 0; c < candidates.size(); c++) {
+        (*scores)[c] = fitness(run.target, &results[c * matches], matches);
+    }
+}
+
+// Small deterministic generator for breeding
+struct TuneRandom {
+    uint32_t state;
+
+    uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+    int below(int n) { return (int)(next() % (uint32_t)n); }
+    double gaussian() {
+        double u = (next() + 0.5) / 4294967296.0;
+        double v = (next() + 0.5) / 4294967296.0;
+        return sqrt(-2.0 * log(u)) * cos(6.283185307 * v);
+    }
+};
+
+void mutate(AIParams* p, AIPersonality personality, int chance, TuneRandom* rng) {
+    int* values = paramValues(p);
+    for (int f = 0; f < PARAM_COUNT; f++) {
+        const ParamField& field = paramFields[f];
+        if (!(field.users & (1 << personality)) || rng->below(100) >= chance) continue;
+
+        double scale = (field.max - field.min) * MUTATION_SCALE;
+        int change = (int)lround(rng->gaussian() * (scale > 1.0 ? scale : 1.0));
+        if (change == 0) change = rng->below(2) ? 1 : -1;
+        values[f] = std::max(field.min, std::min(field.max, values[f] + change));
+    }
+}
+
+int pickParent(const std::vector<double>& scores, TuneRandom* rng) {
+    int best = rng->below((int)scores.size());
+    for (int i = 1; i < SELECT_ROUNDS; i++) {
+        int other = rng->below((int)scores.size());
+        if (scores[other] > scores[best]) best = other;
+    }
+    return best;
+}
+
+// Evolve one personality's preset; returns true and fills best if a tuned
+// set beat the preset on the validation matches
+bool tunePersonality(const TuneRun& run, AIPersonality personality, AIParams* best,
+                     double* presetScore, double* bestScore) {
+    TuneRandom rng = { tuneSeed(run.seed, -1, personality) | 1 };
+    const AIParams& preset = ai_presets[personality];
+
+    // The preset itself plus mutants of it
+    std::vector<AIParams> population(run.population, preset);
+    for (int i = 1; i < run.population; i++) mutate(&population[i], personality, 50, &rng);
+
+    std::vector<double> scores;
+    auto start = std::chrono::steady_clock::now();
+    for (int gen = 1; gen <= run.generations; gen++) {
+        evaluate(run, personality, population, gen, run.matches, &scores);
+
+        std::vector<int> order(population.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = (int)i;
+        std::stable_sort(order.begin(), order.end(), [&scores](int a, int b) { return scores[a] > scores[b]; });
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printf("%s generation %3d: best %+.3f, median %+.3f, %.1f s\n", personalityNames[personality], gen,
+               scores[order[0]], scores[order[order.size() / 2]], seconds);
+        fflush(stdout);
+
+        // Elites survive to be measured again on the next generation's seeds
+        std::vector<AIParams> next;
+        for (int i = 0; i < ELITE_COUNT && i < (int)order.size(); i++) next.push_back(population[order[i]]);
+        while ((int)next.size() < run.population) {
+            const AIParams& a = population[pickParent(scores, &rng)];
+            const AIParams& b = population[pickParent(scores, &rng)];
+            AIParams child = a;
+            for (int f = 0; f < PARAM_COUNT; f++) {
+                if (rng.below(2)) paramValues(&child)[f] = paramValues(&b)[f];
+            }
+            mutate(&child, personality, MUTATION_CHANCE, &rng);
+            next.push_back(child);
+        }
+        population.swap(next);
+    }
+
+    // The surviving elites against the preset, on matches none of them trained on
+    std::vector<AIParams> finalists(population.begin(), population.begin() + ELITE_COUNT);
+    finalists.push_back(preset);
+    evaluate(run, personality, finalists, run.generations + 1, run.matches * VALIDATION_FACTOR, &scores);
+
+    int winner = 0;
+    for (int i = 1; i < ELITE_COUNT; i++) {
+        if (scores[i] > scores[winner]) winner = i;
+    }
+    *presetScore = scores[ELITE_COUNT];
+    *bestScore = scores[winner];
+    *best = finalists[winner];
+    return scores[winner] > scores[ELITE_COUNT];
+}
+
+bool writePresets(const char* path, const AIParams* presets, const char* note) {
+    FILE* f = fopen(path, "w");
+    if (f == nullptr) return false;
+
+    fprintf(f, "#pragma once\n\n");
+    fprintf(f, "// Written by    : src/host/tune_ai.cpp - hand edits are fine too\n");
+    fprintf(f, "// Last tuning   : %s\n", note);
+    fprintf(f, "//\n");
+    fprintf(f, "// Numbers each heuristic personality plays by (AI_PARAMS in ai_player.h).\n");
+    fprintf(f, "// The game runs the policy tables built from these, so rebuild\n");
+    fprintf(f, "// src/ai_policy.h with src/host/gen_policy.cpp after any change. Fields a\n");
+    fprintf(f, "// personality does not use are 0.\n\n");
+    fprintf(f, "constexpr AIParams ai_presets[AI_PRESET_COUNT] = {\n");
+    for (int p = 0; p < AI_PRESET_COUNT; p++) {
+        fprintf(f, "    {  // %s\n", personalityNames[p]);
+        const int* values = paramValues(&presets[p]);
+        for (int i = 0; i < PARAM_COUNT; i++) {
+            char value[16];
+            snprintf(value, sizeof(value), "%d,", values[i]);
+            fprintf(f, "        %-5s// %s\n", value, paramFields[i].name);
+        }
+        fprintf(f, "    },\n");
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+    return true;
+}
+
+int personalityByName(const char* name) {
+    for (int p = 0; p < NAMED_PERSONALITIES; p++) {
+        if (strcasecmp(name, personalityNames[p]) == 0) return p;
+    }
+    return -1;
+}
+
+int main(int argc, char** argv) {
+    const char* output = "src/ai_presets.h";
+    TuneRun run;
+    run.against = AI_BALANCED;
+    run.target = TARGET_BALANCE;
+    run.generations = 30;
+    run.population = 32;
+    run.matches = 64;
+    run.threads = (int)std::thread::hardware_concurrency();
+    run.seed = 1;
+    std::vector<AIPersonality> tuned;
+
+    for (int i = 1; i < argc; i++) {
+        bool more = i + 1 < argc;
+        if (strcmp(argv[i], "--personality") == 0 && more) {
+            int p = personalityByName(argv[++i]);
+            if (p < 0 || p >= AI_PRESET_COUNT) {
+                fprintf(stderr, "Only AGGRESSIVE, DEFENSIVE, BALANCED and RANDOM have presets to tune\n");
+                return 1;
+            }
+            tuned.push_back((AIPersonality)p);
+        } else if (strcmp(argv[i], "--against") == 0 && more) {
+            int p = personalityByName(argv[++i]);
+            if (p < 0) {
+                fprintf(stderr, "Unknown personality %s\n", argv[i]);
+                return 1;
+            }
+            run.against = (AIPersonality)p;
+        } else if (strcmp(argv[i], "--target") == 0 && more) {
+            const char* name = argv[++i];
+            int t = 0;
+            while (t < 3 && strcmp(name, targetNames[t]) != 0) t++;
+            if (t == 3) {
+                fprintf(stderr, "Unknown target %s - use balance, length or wins\n", name);
+                return 1;
+            }
+            run.target = (Target)t;
+        } else if (strcmp(argv[i], "--generations") == 0 && more) {
+            run.generations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--population") == 0 && more) {
+            run.population = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--matches") == 0 && more) {
+            run.matches = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && more) {
+            run.threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && more) {
+            run.seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else {
+            output = argv[i];
+        }
+    }
+    if (run.population < ELITE_COUNT + 1) run.population = ELITE_COUNT + 1;
+    if (run.matches < 2) run.matches = 2;
+    run.matches += run.matches % 2;  // Whole seeds, played from both sides
+    if (run.threads < 1) run.threads = 1;
+    if (tuned.empty()) {
+        for (int p = 0; p < AI_PRESET_COUNT; p++) tuned.push_back((AIPersonality)p);
+    }
+
+    AIParams presets[AI_PRESET_COUNT];
+    memcpy(presets, ai_presets, sizeof(presets));
+
+    char note[512];
+    snprintf(note, sizeof(note), "target %s against %s, seed %u", targetNames[run.target],
+             personalityNames[run.against], (unsigned)run.seed);
+    int changed = 0;
+    for (size_t i = 0; i < tuned.size(); i++) {
+        AIPersonality p = tuned[i];
+        AIParams best;
+        double presetScore;
+        double bestScore;
+        bool better = tunePersonality(run, p, &best, &presetScore, &bestScore);
+        printf("%s: preset %+.3f, tuned %+.3f - %s\n", personalityNames[p], presetScore, bestScore,
+               better ? "tuned set kept" : "preset kept");
+        if (!better) continue;
+
+        presets[p] = best;
+        changed++;
+        char line[96];
+        snprintf(line, sizeof(line), ", %s %+.3f -> %+.3f", personalityNames[p], presetScore, bestScore);
+        strncat(note, line, sizeof(note) - strlen(note) - 1);
+    }
+
+    if (changed == 0) {
+        printf("No preset improved - %s left as it is\n", output);
+        return 0;
+    }
+    if (!writePresets(output, presets, note)) {
+        fprintf(stderr, "Could not write %s\n", output);
+        return 1;
+    }
+    printf("%d presets -> %s - now rebuild the policy tables with native_policy\n", changed, output);
+    return 0;
+}
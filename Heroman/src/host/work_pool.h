@@ -0,0 +1,78 @@
+#pragma once
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing pool for a batch of independent jobs
+//
+// Jobs are numbered 0 .. count - 1. Each worker starts with an equal slice
+// of the numbers and takes jobs from the front of it; a worker whose slice
+// runs dry steals the back half of another's. Headless matches range from a
+// few seconds to draws at the tick limit, so fixed slices would leave
+// threads idle behind one stuck on long matches, while stealing only costs
+// a lock when a worker runs out.
+
+struct WorkSlice {
+    std::mutex lock;
+    long next;
+    long end;
+    char padding[64];  // Keep neighbouring slices off one cache line
+};
+
+// Take the next job from the front of a slice; false if it is empty
+inline bool workTake(WorkSlice* slice, long* job) {
+    std::lock_guard<std::mutex> guard(slice->lock);
+    if (slice->next >= slice->end) return false;
+    *job = slice->next++;
+    return true;
+}
+
+// Move the back half of victim's jobs into the empty slice thief
+inline bool workSteal(WorkSlice* thief, WorkSlice* victim) {
+    long first;
+    long end;
+    {
+        std::lock_guard<std::mutex> guard(victim->lock);
+        long left = victim->end - victim->next;
+        if (left <= 0) return false;
+        end = victim->end;
+        first = end - (left + 1) / 2;
+        victim->end = first;
+    }
+    std::lock_guard<std::mutex> guard(thief->lock);
+    thief->next = first;
+    thief->end = end;
+    return true;
+}
+
+// Run job(n) for every n in 0 .. count - 1 on threads workers, and return
+// when all are done. job must be safe to call from several threads at once.
+template <typename Job>
+void workPoolRun(int threads, long count, Job job) {
+    if (threads < 1) threads = 1;
+    std::vector<WorkSlice> slices(threads);
+    for (int i = 0; i < threads; i++) {
+        slices[i].next = count * i / threads;
+        slices[i].end = count * (i + 1) / threads;
+    }
+
+    auto worker = [&](int self) {
+        long n;
+        for (;;) {
+            while (workTake(&slices[self], &n)) job(n);
+
+            // Out of work - look for some, starting with the next worker
+            bool stole = false;
+            for (int i = 1; i < threads && !stole; i++) {
+                stole = workSteal(&slices[self], &slices[(self + i) % threads]);
+            }
+            if (!stole) return;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; i++) pool.push_back(std::thread(worker, i));
+    worker(0);
+    for (size_t i = 0; i < pool.size(); i++) pool[i].join();
+}
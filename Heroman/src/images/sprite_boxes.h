@@ -0,0 +1,40 @@
+#pragma once
+
+// Generated by  : tools/gen_sprites.py - do not edit by hand
+// Generated from: sprite_right_red_NN.h
+//
+// Combat boxes for every sprite frame, in the right-facing 46x50 cell.
+// Hurtboxes are the silhouette in 3 horizontal bands; punch frames
+// (3, 4, 17, 18) have a hitbox over the last 6 columns of the fist.
+
+// { hurtCount, hitCount, { hurt { x, y, w, h } }, { hit { x, y, w, h } } }
+constexpr FrameBoxes fighter_boxes[28] = {
+    { 3, 0, { { 14,  3, 16, 15 }, { 12, 18, 22, 15 }, { 14, 33, 14, 15 } }, { {  0,  0,  0,  0 } } },  // Frame 0
+    { 3, 0, { { 17, 18, 13, 10 }, { 15, 28, 19, 10 }, {  6, 38, 28, 10 } }, { {  0,  0,  0,  0 } } },  // Frame 1
+    { 3, 0, { { 14,  4, 16, 14 }, {  9, 18, 20, 15 }, {  8, 33, 29, 15 } }, { {  0,  0,  0,  0 } } },  // Frame 2
+    { 3, 1, { { 14,  4, 27, 14 }, { 10, 18, 31, 15 }, {  8, 33, 29, 15 } }, { { 35, 15,  6,  5 } } },  // Frame 3
+    { 3, 1, { { 13,  4, 20, 14 }, { 11, 18, 26, 15 }, {  9, 33, 29, 15 } }, { { 31, 17,  6,  6 } } },  // Frame 4
+    { 0, 0, { {  0,  0,  0,  0 }, {  0,  0,  0,  0 }, {  0,  0,  0,  0 } }, { {  0,  0,  0,  0 } } },  // Frame 5
+    { 0, 0, { {  0,  0,  0,  0 }, {  0,  0,  0,  0 }, {  0,  0,  0,  0 } }, { {  0,  0,  0,  0 } } },  // Frame 6
+    { 3, 0, { { 12,  4, 20, 14 }, { 13, 18, 20, 15 }, { 16, 33, 10, 15 } }, { {  0,  0,  0,  0 } } },  // Frame 7
+    { 3, 0, { { 10,  8, 23, 13 }, {  8, 21, 28, 14 }, { 14, 35, 24, 14 } }, { {  0,  0,  0,  0 } } },  // Frame 8
+    { 0, 0, { {  0,  0,  0,  0 }, {  0,  0,  0,  0 }, {  0,  0,  0,  0 } }, { {  0,  0,  0,  0 } } },  // Frame 9
+    { 0, 0, { {  0,  0,  0,  0 }, {  0,  0,  0,  0 }, {  0,  0,  0,  0 } }, { {  0,  0,  0,  0 } } },  // Frame 10
+    { 0, 0, { {  0,  0,  0,  0 }, {  0,  0,  0,  0 }, {  0,  0,  0,  0 } }, { {  0,  0,  0,  0 } } },  // Frame 11
+    { 0, 0, { {  0,  0,  0,  0 }, {  0,  0,  0,  0 }, {  0,  0,  0,  0 } }, { {  0,  0,  0,  0 } } },  // Frame 12
+    { 0, 0, { {  0,  0,  0,  0 }, {  0,  0,  0,  0 }, {  0,  0,  0,  0 } }, { {  0,  0,  0,  0 } } },  // Frame 13
+    { 3, 0, { {  5, 13, 25,  9 }, { 10, 22, 34, 10 }, { 12, 32, 30, 10 } }, { {  0,  0,  0,  0 } } },  // Frame 14
+    { 3, 0, { {  7, 30, 22,  6 }, {  7, 36, 29,  6 }, {  6, 42, 39,  6 } }, { {  0,  0,  0,  0 } } },  // Frame 15
+    { 3, 0, { { 16, 13, 14, 11 }, { 10, 24, 24, 12 }, {  6, 36, 28, 12 } }, { {  0,  0,  0,  0 } } },  // Frame 16
+    { 3, 1, { { 16, 13, 19, 11 }, { 11, 24, 31, 12 }, {  5, 36, 28, 12 } }, { { 36, 24,  6,  5 } } },  // Frame 17
+    { 3, 1, { { 17, 13, 11, 11 }, { 12, 24, 26, 12 }, {  6, 36, 28, 12 } }, { { 32, 26,  6,  6 } } },  // Frame 18
+    { 0, 0, { {  0,  0,  0,  0 }, {  0,  0,  0,  0 }, {  0,  0,  0,  0 } }, { {  0,  0,  0,  0 } } },  // Frame 19
+    { 3, 0, { { 17, 10, 22, 12 }, { 14, 22, 25, 13 }, {  5, 35, 27, 13 } }, { {  0,  0,  0,  0 } } },  // Frame 20
+    { 3, 0, { { 15, 11, 23, 12 }, {  3, 23, 35, 12 }, {  2, 35, 35, 13 } }, { {  0,  0,  0,  0 } } },  // Frame 21
+    { 3, 0, { { 20, 10, 18, 12 }, {  9, 22, 31, 13 }, {  8, 35, 21, 13 } }, { {  0,  0,  0,  0 } } },  // Frame 22
+    { 3, 0, { { 22, 10, 13, 12 }, { 13, 22, 21, 13 }, { 12, 35, 15, 13 } }, { {  0,  0,  0,  0 } } },  // Frame 23
+    { 3, 0, { { 18, 10, 19, 12 }, { 14, 22, 24, 13 }, {  5, 35, 27, 13 } }, { {  0,  0,  0,  0 } } },  // Frame 24
+    { 3, 0, { { 16, 11, 23, 12 }, {  2, 23, 37, 12 }, {  2, 35, 34, 13 } }, { {  0,  0,  0,  0 } } },  // Frame 25
+    { 3, 0, { { 22, 10, 14, 12 }, { 10, 22, 25, 13 }, {  9, 35, 18, 13 } }, { {  0,  0,  0,  0 } } },  // Frame 26
+    { 3, 0, { { 17, 10, 18, 12 }, { 11, 22, 24, 13 }, { 11, 35, 16, 13 } }, { {  0,  0,  0,  0 } } },  // Frame 27
+};
@@ -0,0 +1,533 @@
+#pragma once
+
+// Generated by  : tools/gen_sprites.py - do not edit by hand
+// Generated from: sprite_right_red_NN.h
+//
+// Collision masks for every sprite frame: one uint64_t per row of the
+// frame's trimmed box, bit x set when column x of the 46-wide cell is opaque.
+// Each frame has the right-facing rows and the same rows mirrored for a
+// left-facing fighter, so no bits are reversed at runtime.
+
+const uint64_t sprite_mask_empty[1] PROGMEM = { 0 };
+
+const uint64_t sprite_mask_00_right[45] PROGMEM = {
+0x000000C00000ULL, 0x000003F00000ULL, 0x000007F00000ULL, 0x00000FF80000ULL,
+0x00000FF80000ULL, 0x000007F80000ULL, 0x000007F80000ULL, 0x000007F80000ULL,
+0x000003F00000ULL, 0x000001F80000ULL, 0x000007FE0000ULL, 0x00000FFF0000ULL,
+0x00001FFF8000ULL, 0x00003FFFC000ULL, 0x00003FFFC000ULL, 0x00007FFFE000ULL,
+0x00007FFBE000ULL, 0x0000FFF1E000ULL, 0x0000FFF1E000ULL, 0x0001FFF1F000ULL,
+0x0001EFF0F000ULL, 0x0001EFF0F000ULL, 0x0003CFF8F000ULL, 0x0003CFF8F000ULL,
+0x0003EFF9F000ULL, 0x0003EFF9F000ULL, 0x0001CFF8E000ULL, 0x00000FFC0000ULL,
+0x00000FFC0000ULL, 0x00000FFC0000ULL, 0x00000FBC0000ULL, 0x000007BC0000ULL,
+0x000007BE0000ULL, 0x0000079E0000ULL, 0x000007DE0000ULL, 0x000007DE0000ULL,
+0x000007DF0000ULL, 0x000003DF0000ULL, 0x000003CF0000ULL, 0x000003CF8000ULL,
+0x000003CF8000ULL, 0x000003CF8000ULL, 0x000007CF8000ULL, 0x00000FCFC000ULL,
+0x00000FCFC000ULL,
+};
+const uint64_t sprite_mask_00_left[45] PROGMEM = {
+0x000000C00000ULL, 0x000003F00000ULL, 0x000003F80000ULL, 0x000007FC0000ULL,
+0x000007FC0000ULL, 0x000007F80000ULL, 0x000007F80000ULL, 0x000007F80000ULL,
+0x000003F00000ULL, 0x000007E00000ULL, 0x00001FF80000ULL, 0x00003FFC0000ULL,
+0x00007FFE0000ULL, 0x0000FFFF0000ULL, 0x0000FFFF0000ULL, 0x0001FFFF8000ULL,
+0x0001F7FF8000ULL, 0x0001E3FFC000ULL, 0x0001E3FFC000ULL, 0x0003E3FFE000ULL,
+0x0003C3FDE000ULL, 0x0003C3FDE000ULL, 0x0003C7FCF000ULL, 0x0003C7FCF000ULL,
+0x0003E7FDF000ULL, 0x0003E7FDF000ULL, 0x0001C7FCE000ULL, 0x00000FFC0000ULL,
+0x00000FFC0000ULL, 0x00000FFC0000ULL, 0x00000F7C0000ULL, 0x00000F780000ULL,
+0x00001F780000ULL, 0x00001E780000ULL, 0x00001EF80000ULL, 0x00001EF80000ULL,
+0x00003EF80000ULL, 0x00003EF00000ULL, 0x00003CF00000ULL, 0x00007CF00000ULL,
+0x00007CF00000ULL, 0x00007CF00000ULL, 0x00007CF80000ULL, 0x0000FCFC0000ULL,
+0x0000FCFC0000ULL,
+};
+
+const uint64_t sprite_mask_01_right[30] PROGMEM = {
+0x000001800000ULL, 0x000007E00000ULL, 0x00000FE00000ULL, 0x00001FF00000ULL,
+0x00001FF00000ULL, 0x00000FF00000ULL, 0x00000FF00000ULL, 0x00000FF00000ULL,
+0x00001FF80000ULL, 0x00003FFE0000ULL, 0x00007FFF0000ULL, 0x0000FFFF0000ULL,
+0x0000FFFF8000ULL, 0x0001F7FF8000ULL, 0x0001FBFF8000ULL, 0x0001FFFF8000ULL,
+0x0003FFFF8000ULL, 0x0003FFFF8000ULL, 0x0003FFFF8000ULL, 0x0003FFFF0000ULL,
+0x0003FFFF0000ULL, 0x0001E3FF8000ULL, 0x0001F03F9E00ULL, 0x0001F03FFF00ULL,
+0x0001F01FFF80ULL, 0x0000F81FFF80ULL, 0x0000F83FFFC0ULL, 0x0001F83FFFC0ULL,
+0x0003F83FF7C0ULL, 0x0003F01FE380ULL,
+};
+const uint64_t sprite_mask_01_left[30] PROGMEM = {
+0x000000600000ULL, 0x000001F80000ULL, 0x000001FC0000ULL, 0x000003FE0000ULL,
+0x000003FE0000ULL, 0x000003FC0000ULL, 0x000003FC0000ULL, 0x000003FC0000ULL,
+0x000007FE0000ULL, 0x00001FFF0000ULL, 0x00003FFF8000ULL, 0x00003FFFC000ULL,
+0x00007FFFC000ULL, 0x00007FFBE000ULL, 0x00007FF7E000ULL, 0x00007FFFE000ULL,
+0x00007FFFF000ULL, 0x00007FFFF000ULL, 0x00007FFFF000ULL, 0x00003FFFF000ULL,
+0x00003FFFF000ULL, 0x00007FF1E000ULL, 0x001E7F03E000ULL, 0x003FFF03E000ULL,
+0x007FFE03E000ULL, 0x007FFE07C000ULL, 0x00FFFF07C000ULL, 0x00FFFF07E000ULL,
+0x00FBFF07F000ULL, 0x0071FE03F000ULL,
+};
+
+const uint64_t sprite_mask_02_right[44] PROGMEM = {
+0x0000000C0000ULL, 0x0000003F0000ULL, 0x0000007F0000ULL, 0x000000FF8000ULL,
+0x000000FF8000ULL, 0x0000007F8000ULL, 0x0000007F8000ULL, 0x000000FF8000ULL,
+0x000001FF0000ULL, 0x000007FF0000ULL, 0x00001FFF8000ULL, 0x00003FFFC000ULL,
+0x00003FFFC000ULL, 0x00003FFFC000ULL, 0x00001FFFC000ULL, 0x000003FFC000ULL,
+0x000001FFFC00ULL, 0x000001FFFE00ULL, 0x000001FFFE00ULL, 0x000001FEFE00ULL,
+0x000001FE1C00ULL, 0x000001FE0000ULL, 0x000001FE0000ULL, 0x000001FF0000ULL,
+0x000003FF8000ULL, 0x000003FF8000ULL, 0x000007FFC000ULL, 0x000007FFC000ULL,
+0x00000FE7E000ULL, 0x00000FC3E000ULL, 0x00001F83E000ULL, 0x00003F01F000ULL,
+0x00003E01F000ULL, 0x00007C00F800ULL, 0x00007C00F800ULL, 0x0000F800F800ULL,
+0x0001F000F800ULL, 0x0001F000F800ULL, 0x0003E000F800ULL, 0x0003E000FC00ULL,
+0x0007E000FC00ULL, 0x000FC0007E00ULL, 0x001F80007F00ULL, 0x001F80007F00ULL,
+};
+const uint64_t sprite_mask_02_left[44] PROGMEM = {
+0x00000C000000ULL, 0x00003F000000ULL, 0x00003F800000ULL, 0x00007FC00000ULL,
+0x00007FC00000ULL, 0x00007F800000ULL, 0x00007F800000ULL, 0x00007FC00000ULL,
+0x00003FE00000ULL, 0x00003FF80000ULL, 0x00007FFE0000ULL, 0x0000FFFF0000ULL,
+0x0000FFFF0000ULL, 0x0000FFFF0000ULL, 0x0000FFFE0000ULL, 0x0000FFF00000ULL,
+0x000FFFE00000ULL, 0x001FFFE00000ULL, 0x001FFFE00000ULL, 0x001FDFE00000ULL,
+0x000E1FE00000ULL, 0x00001FE00000ULL, 0x00001FE00000ULL, 0x00003FE00000ULL,
+0x00007FF00000ULL, 0x00007FF00000ULL, 0x0000FFF80000ULL, 0x0000FFF80000ULL,
+0x0001F9FC0000ULL, 0x0001F0FC0000ULL, 0x0001F07E0000ULL, 0x0003E03F0000ULL,
+0x0003E01F0000ULL, 0x0007C00F8000ULL, 0x0007C00F8000ULL, 0x0007C007C000ULL,
+0x0007C003E000ULL, 0x0007C003E000ULL, 0x0007C001F000ULL, 0x000FC001F000ULL,
+0x000FC001F800ULL, 0x001F8000FC00ULL, 0x003F80007E00ULL, 0x003F80007E00ULL,
+};
+
+const uint64_t sprite_mask_03_right[44] PROGMEM = {
+0x000000180000ULL, 0x0000007E0000ULL, 0x000000FE0000ULL, 0x000001FF0000ULL,
+0x000001FF0000ULL, 0x000000FF0000ULL, 0x000000FF0000ULL, 0x000000FF0000ULL,
+0x0000007E0000ULL, 0x000007FF0000ULL, 0x0003FFFF8000ULL, 0x00FFFFFFC000ULL,
+0x01FFFFFFC000ULL, 0x01FFFFFFC000ULL, 0x01FFFFFFC000ULL, 0x00E003FFC000ULL,
+0x000001FFF800ULL, 0x000001FFFC00ULL, 0x000001FFFC00ULL, 0x000001FFFC00ULL,
+0x000001FE3800ULL, 0x000001FE0000ULL, 0x000001FE0000ULL, 0x000001FF0000ULL,
+0x000003FF8000ULL, 0x000003FF8000ULL, 0x000007FFC000ULL, 0x000007FFC000ULL,
+0x00000FE7E000ULL, 0x00000FC3E000ULL, 0x00001F83E000ULL, 0x00003F01F000ULL,
+0x00003E01F000ULL, 0x00007C00F800ULL, 0x00007C00F800ULL, 0x0000F800F800ULL,
+0x0001F000F800ULL, 0x0001F000F800ULL, 0x0003E000F800ULL, 0x0003E000FC00ULL,
+0x0007E000FC00ULL, 0x000FC0007E00ULL, 0x001F80007F00ULL, 0x001F80007F00ULL,
+};
+const uint64_t sprite_mask_03_left[44] PROGMEM = {
+0x000006000000ULL, 0x00001F800000ULL, 0x00001FC00000ULL, 0x00003FE00000ULL,
+0x00003FE00000ULL, 0x00003FC00000ULL, 0x00003FC00000ULL, 0x00003FC00000ULL,
+0x00001F800000ULL, 0x00003FF80000ULL, 0x00007FFFF000ULL, 0x0000FFFFFFC0ULL,
+0x0000FFFFFFE0ULL, 0x0000FFFFFFE0ULL, 0x0000FFFFFFE0ULL, 0x0000FFF001C0ULL,
+0x0007FFE00000ULL, 0x000FFFE00000ULL, 0x000FFFE00000ULL, 0x000FFFE00000ULL,
+0x00071FE00000ULL, 0x00001FE00000ULL, 0x00001FE00000ULL, 0x00003FE00000ULL,
+0x00007FF00000ULL, 0x00007FF00000ULL, 0x0000FFF80000ULL, 0x0000FFF80000ULL,
+0x0001F9FC0000ULL, 0x0001F0FC0000ULL, 0x0001F07E0000ULL, 0x0003E03F0000ULL,
+0x0003E01F0000ULL, 0x0007C00F8000ULL, 0x0007C00F8000ULL, 0x0007C007C000ULL,
+0x0007C003E000ULL, 0x0007C003E000ULL, 0x0007C001F000ULL, 0x000FC001F000ULL,
+0x000FC001F800ULL, 0x001F8000FC00ULL, 0x003F80007E00ULL, 0x003F80007E00ULL,
+};
+
+const uint64_t sprite_mask_04_right[44] PROGMEM = {
+0x000000300000ULL, 0x000000FC0000ULL, 0x000001FC0000ULL, 0x000003FE0000ULL,
+0x000003FE0000ULL, 0x000001FE0000ULL, 0x000001FE0000ULL, 0x000001FE0000ULL,
+0x000000FC0000ULL, 0x000001FC0000ULL, 0x000007FF0000ULL, 0x00001FFF8000ULL,
+0x00007FFFC000ULL, 0x0001FFFFE000ULL, 0x000FFFFFF000ULL, 0x001FFFFFF000ULL,
+0x001FC3FFF800ULL, 0x001F03FFF800ULL, 0x000C03FFF800ULL, 0x000003FCF000ULL,
+0x000003FC0000ULL, 0x000003FC0000ULL, 0x000007FC0000ULL, 0x000007FC0000ULL,
+0x00000FFE0000ULL, 0x00000FFE0000ULL, 0x00001FFE0000ULL, 0x00003FFE0000ULL,
+0x00003F7F0000ULL, 0x00007E3F0000ULL, 0x0000FC1F0000ULL, 0x0001F80F8000ULL,
+0x0001F00F8000ULL, 0x0001F007C000ULL, 0x0003F007C000ULL, 0x0003F007E000ULL,
+0x0003E003E000ULL, 0x0003E003F000ULL, 0x0003E001F000ULL, 0x0007C001F800ULL,
+0x000FC000F800ULL, 0x001FC000FC00ULL, 0x003F8000FE00ULL, 0x003F8000FE00ULL,
+};
+const uint64_t sprite_mask_04_left[44] PROGMEM = {
+0x000003000000ULL, 0x00000FC00000ULL, 0x00000FE00000ULL, 0x00001FF00000ULL,
+0x00001FF00000ULL, 0x00001FE00000ULL, 0x00001FE00000ULL, 0x00001FE00000ULL,
+0x00000FC00000ULL, 0x00000FE00000ULL, 0x00003FF80000ULL, 0x00007FFE0000ULL,
+0x0000FFFF8000ULL, 0x0001FFFFE000ULL, 0x0003FFFFFC00ULL, 0x0003FFFFFE00ULL,
+0x0007FFF0FE00ULL, 0x0007FFF03E00ULL, 0x0007FFF00C00ULL, 0x0003CFF00000ULL,
+0x00000FF00000ULL, 0x00000FF00000ULL, 0x00000FF80000ULL, 0x00000FF80000ULL,
+0x00001FFC0000ULL, 0x00001FFC0000ULL, 0x00001FFE0000ULL, 0x00001FFF0000ULL,
+0x00003FBF0000ULL, 0x00003F1F8000ULL, 0x00003E0FC000ULL, 0x00007C07E000ULL,
+0x00007C03E000ULL, 0x0000F803E000ULL, 0x0000F803F000ULL, 0x0001F803F000ULL,
+0x0001F001F000ULL, 0x0003F001F000ULL, 0x0003E001F000ULL, 0x0007E000F800ULL,
+0x0007C000FC00ULL, 0x000FC000FE00ULL, 0x001FC0007F00ULL, 0x001FC0007F00ULL,
+};
+
+const uint64_t sprite_mask_07_right[44] PROGMEM = {
+0x000006000000ULL, 0x00001F800000ULL, 0x00003F800000ULL, 0x00007FC00000ULL,
+0x00007FC00000ULL, 0x00003FC00000ULL, 0x00003FC00000ULL, 0x00003FFC0000ULL,
+0x00003FFF0000ULL, 0x00001FFF8000ULL, 0x00001FFFC000ULL, 0x00003FFFE000ULL,
+0x00007FFFF000ULL, 0x0000FFFFF000ULL, 0x0000FFFFE000ULL, 0x0001FFFFC000ULL,
+0x0001FFFF8000ULL, 0x0001F3FF0000ULL, 0x0001F9FE0000ULL, 0x0000F9FE0000ULL,
+0x0000FFFC0000ULL, 0x0000FFFE0000ULL, 0x00007FFE0000ULL, 0x00003FFE0000ULL,
+0x00003FFC0000ULL, 0x00001FF80000ULL, 0x00000FF00000ULL, 0x000007F00000ULL,
+0x000003F80000ULL, 0x000003FC0000ULL, 0x000003FE0000ULL, 0x000003FF0000ULL,
+0x000001FF0000ULL, 0x000001FF0000ULL, 0x000001FF0000ULL, 0x000001FE0000ULL,
+0x000001F00000ULL, 0x000001F00000ULL, 0x000001F00000ULL, 0x000001F00000ULL,
+0x000001F00000ULL, 0x000003E00000ULL, 0x000003C00000ULL, 0x000001800000ULL,
+};
+const uint64_t sprite_mask_07_left[44] PROGMEM = {
+0x000000180000ULL, 0x0000007E0000ULL, 0x0000007F0000ULL, 0x000000FF8000ULL,
+0x000000FF8000ULL, 0x000000FF0000ULL, 0x000000FF0000ULL, 0x00000FFF0000ULL,
+0x00003FFF0000ULL, 0x00007FFE0000ULL, 0x0000FFFE0000ULL, 0x0001FFFF0000ULL,
+0x0003FFFF8000ULL, 0x0003FFFFC000ULL, 0x0001FFFFC000ULL, 0x0000FFFFE000ULL,
+0x00007FFFE000ULL, 0x00003FF3E000ULL, 0x00001FE7E000ULL, 0x00001FE7C000ULL,
+0x00000FFFC000ULL, 0x00001FFFC000ULL, 0x00001FFF8000ULL, 0x00001FFF0000ULL,
+0x00000FFF0000ULL, 0x000007FE0000ULL, 0x000003FC0000ULL, 0x000003F80000ULL,
+0x000007F00000ULL, 0x00000FF00000ULL, 0x00001FF00000ULL, 0x00003FF00000ULL,
+0x00003FE00000ULL, 0x00003FE00000ULL, 0x00003FE00000ULL, 0x00001FE00000ULL,
+0x000003E00000ULL, 0x000003E00000ULL, 0x000003E00000ULL, 0x000003E00000ULL,
+0x000003E00000ULL, 0x000001F00000ULL, 0x000000F00000ULL, 0x000000600000ULL,
+};
+
+const uint64_t sprite_mask_08_right[41] PROGMEM = {
+0x00000001E000ULL, 0x00000003F000ULL, 0x00000003F800ULL, 0x00000007FC00ULL,
+0x0000000FFC00ULL, 0x0000000FFC00ULL, 0x0000000FF800ULL, 0x000000FFF000ULL,
+0x00000FFFC000ULL, 0x00003FFFE000ULL, 0x00007FFFF000ULL, 0x0000FFFFF800ULL,
+0x0001FFFFFC00ULL, 0x0003E1FFFE00ULL, 0x0007C3FFFF00ULL, 0x000F83FE3F00ULL,
+0x000F87FC1F00ULL, 0x000F0FF81F00ULL, 0x00061FF03E00ULL, 0x00003FF07C00ULL,
+0x00007FF0FC00ULL, 0x0000FFF0F800ULL, 0x0001FFF0F800ULL, 0x0001FBF07000ULL,
+0x0003F1F00000ULL, 0x0003E1F00000ULL, 0x0003E1F00000ULL, 0x0003E1F00000ULL,
+0x0003E1F00000ULL, 0x0003E0F80000ULL, 0x0003E0F80000ULL, 0x0003E07C0000ULL,
+0x0003E07C0000ULL, 0x0003E03E0000ULL, 0x0003C03E0000ULL, 0x0007C01E0000ULL,
+0x000FC01F0000ULL, 0x001FC01F0000ULL, 0x003F801F8000ULL, 0x003F801FC000ULL,
+0x0000000FC000ULL,
+};
+const uint64_t sprite_mask_08_left[41] PROGMEM = {
+0x0001E0000000ULL, 0x0003F0000000ULL, 0x0007F0000000ULL, 0x000FF8000000ULL,
+0x000FFC000000ULL, 0x000FFC000000ULL, 0x0007FC000000ULL, 0x0003FFC00000ULL,
+0x0000FFFC0000ULL, 0x0001FFFF0000ULL, 0x0003FFFF8000ULL, 0x0007FFFFC000ULL,
+0x000FFFFFE000ULL, 0x001FFFE1F000ULL, 0x003FFFF0F800ULL, 0x003F1FF07C00ULL,
+0x003E0FF87C00ULL, 0x003E07FC3C00ULL, 0x001F03FE1800ULL, 0x000F83FF0000ULL,
+0x000FC3FF8000ULL, 0x0007C3FFC000ULL, 0x0007C3FFE000ULL, 0x000383F7E000ULL,
+0x000003E3F000ULL, 0x000003E1F000ULL, 0x000003E1F000ULL, 0x000003E1F000ULL,
+0x000003E1F000ULL, 0x000007C1F000ULL, 0x000007C1F000ULL, 0x00000F81F000ULL,
+0x00000F81F000ULL, 0x00001F01F000ULL, 0x00001F00F000ULL, 0x00001E00F800ULL,
+0x00003E00FC00ULL, 0x00003E00FE00ULL, 0x00007E007F00ULL, 0x0000FE007F00ULL,
+0x0000FC000000ULL,
+};
+
+const uint64_t sprite_mask_14_right[29] PROGMEM = {
+0x000000000F00ULL, 0x000000001F80ULL, 0x00001C001FC0ULL, 0x00003FF03FE0ULL,
+0x00003FFE7FE0ULL, 0x00003FFF7FE0ULL, 0x000017FFFFC0ULL, 0x0000003FFF80ULL,
+0x0000000FFF00ULL, 0x0007FFFFF800ULL, 0x000FFFFFF800ULL, 0x001FFFFFFC00ULL,
+0x001FFFFFFC00ULL, 0x003FFFFFFC00ULL, 0x007C1FFFFC00ULL, 0x0EFC1FFFFC00ULL,
+0x0FF87FE0FC00ULL, 0x0FF0FF80F800ULL, 0x07E1FE01F800ULL, 0x03C3F801F000ULL,
+0x0183F003F000ULL, 0x0007E003E000ULL, 0x0007C007C000ULL, 0x000F801F8000ULL,
+0x001F003F0000ULL, 0x007E001E0000ULL, 0x00FE003E0000ULL, 0x00FC001C0000ULL,
+0x00F000000000ULL,
+};
+const uint64_t sprite_mask_14_left[29] PROGMEM = {
+0x003C00000000ULL, 0x007E00000000ULL, 0x00FE000E0000ULL, 0x01FF03FF0000ULL,
+0x01FF9FFF0000ULL, 0x01FFBFFF0000ULL, 0x00FFFFFA0000ULL, 0x007FFF000000ULL,
+0x003FFC000000ULL, 0x0007FFFFF800ULL, 0x0007FFFFFC00ULL, 0x000FFFFFFE00ULL,
+0x000FFFFFFE00ULL, 0x000FFFFFFF00ULL, 0x000FFFFE0F80ULL, 0x000FFFFE0FDCULL,
+0x000FC1FF87FCULL, 0x0007C07FC3FCULL, 0x0007E01FE1F8ULL, 0x0003E007F0F0ULL,
+0x0003F003F060ULL, 0x0001F001F800ULL, 0x0000F800F800ULL, 0x00007E007C00ULL,
+0x00003F003E00ULL, 0x00001E001F80ULL, 0x00001F001FC0ULL, 0x00000E000FC0ULL,
+0x0000000003C0ULL,
+};
+
+const uint64_t sprite_mask_15_right[18] PROGMEM = {
+0x000000000C00ULL, 0x000000003F00ULL, 0x00000E007F00ULL, 0x00001FF8FF80ULL,
+0x00001FFFFF80ULL, 0x00001FFFFF80ULL, 0x00000FFFFF80ULL, 0x0000001FFF80ULL,
+0x00000007FF00ULL, 0x00001FFFFE00ULL, 0x0001FFFFFE00ULL, 0x000FFFFFFF00ULL,
+0x1C7FFFFFFF00ULL, 0x1FFFFFFFFF80ULL, 0x1FFFFFFFFF80ULL, 0x1FFFFFFFFFC0ULL,
+0x1FFBFFFE7FC0ULL, 0x0FC1FFC03F80ULL,
+};
+const uint64_t sprite_mask_15_left[18] PROGMEM = {
+0x000C00000000ULL, 0x003F00000000ULL, 0x003F801C0000ULL, 0x007FC7FE0000ULL,
+0x007FFFFE0000ULL, 0x007FFFFE0000ULL, 0x007FFFFC0000ULL, 0x007FFE000000ULL,
+0x003FF8000000ULL, 0x001FFFFE0000ULL, 0x001FFFFFE000ULL, 0x003FFFFFFC00ULL,
+0x003FFFFFFF8EULL, 0x007FFFFFFFFEULL, 0x007FFFFFFFFEULL, 0x00FFFFFFFFFEULL,
+0x00FF9FFFF7FEULL, 0x007F00FFE0FCULL,
+};
+
+const uint64_t sprite_mask_16_right[35] PROGMEM = {
+0x000000180000ULL, 0x0000007E0000ULL, 0x000000FE0000ULL, 0x000001FF0000ULL,
+0x000001FF0000ULL, 0x000000FF0000ULL, 0x000000FF0000ULL, 0x000001FF0000ULL,
+0x000003FE0000ULL, 0x00000FFE0000ULL, 0x00003FFF0000ULL, 0x00007FFF8000ULL,
+0x00007FFF8000ULL, 0x00007FFF8000ULL, 0x00003FFF8000ULL, 0x000007FF8000ULL,
+0x000003FFF800ULL, 0x000003FFFC00ULL, 0x000003FFFC00ULL, 0x000003FDFC00ULL,
+0x0000FFFC3800ULL, 0x0001FFFC0000ULL, 0x0003FFFC0000ULL, 0x0003FFFC0000ULL,
+0x0003FFFE0000ULL, 0x0003FFFF0000ULL, 0x0001E1FF0000ULL, 0x0001F07F8E00ULL,
+0x0001F03FFF00ULL, 0x0001F01FFF80ULL, 0x0000F81FFFC0ULL, 0x0000F80FFFC0ULL,
+0x0001F807FFC0ULL, 0x0003F801F3C0ULL, 0x0003F000E180ULL,
+};
+const uint64_t sprite_mask_16_left[35] PROGMEM = {
+0x000006000000ULL, 0x00001F800000ULL, 0x00001FC00000ULL, 0x00003FE00000ULL,
+0x00003FE00000ULL, 0x00003FC00000ULL, 0x00003FC00000ULL, 0x00003FE00000ULL,
+0x00001FF00000ULL, 0x00001FFC0000ULL, 0x00003FFF0000ULL, 0x00007FFF8000ULL,
+0x00007FFF8000ULL, 0x00007FFF8000ULL, 0x00007FFF0000ULL, 0x00007FF80000ULL,
+0x0007FFF00000ULL, 0x000FFFF00000ULL, 0x000FFFF00000ULL, 0x000FEFF00000ULL,
+0x00070FFFC000ULL, 0x00000FFFE000ULL, 0x00000FFFF000ULL, 0x00000FFFF000ULL,
+0x00001FFFF000ULL, 0x00003FFFF000ULL, 0x00003FE1E000ULL, 0x001C7F83E000ULL,
+0x003FFF03E000ULL, 0x007FFE03E000ULL, 0x00FFFE07C000ULL, 0x00FFFC07C000ULL,
+0x00FFF807E000ULL, 0x00F3E007F000ULL, 0x0061C003F000ULL,
+};
+
+const uint64_t sprite_mask_17_right[35] PROGMEM = {
+0x000000300000ULL, 0x000000FC0000ULL, 0x000001FC0000ULL, 0x000003FE0000ULL,
+0x000003FE0000ULL, 0x000001FE0000ULL, 0x000001FE0000ULL, 0x000001FE0000ULL,
+0x000000FC0000ULL, 0x00000FFE0000ULL, 0x0007FFFF0000ULL, 0x01FFFFFF8000ULL,
+0x03FFFFFF8000ULL, 0x03FFFFFF8000ULL, 0x03FFFFFF8000ULL, 0x01C007FF8000ULL,
+0x000003FFF000ULL, 0x000003FFF800ULL, 0x000003FFF800ULL, 0x000003FFF800ULL,
+0x00007FFC7000ULL, 0x0000FFFC0000ULL, 0x0001FFFE0000ULL, 0x0001FFFE0000ULL,
+0x0001FFFF0000ULL, 0x0001FFFF8000ULL, 0x0000F0FF8000ULL, 0x0000F83FC700ULL,
+0x0000F81FFF80ULL, 0x0000F80FFFC0ULL, 0x00007C0FFFE0ULL, 0x00007C07FFE0ULL,
+0x0000FC03FFE0ULL, 0x0001FC00F9E0ULL, 0x0001F80070C0ULL,
+};
+const uint64_t sprite_mask_17_left[35] PROGMEM = {
+0x000003000000ULL, 0x00000FC00000ULL, 0x00000FE00000ULL, 0x00001FF00000ULL,
+0x00001FF00000ULL, 0x00001FE00000ULL, 0x00001FE00000ULL, 0x00001FE00000ULL,
+0x00000FC00000ULL, 0x00001FFC0000ULL, 0x00003FFFF800ULL, 0x00007FFFFFE0ULL,
+0x00007FFFFFF0ULL, 0x00007FFFFFF0ULL, 0x00007FFFFFF0ULL, 0x00007FF800E0ULL,
+0x0003FFF00000ULL, 0x0007FFF00000ULL, 0x0007FFF00000ULL, 0x0007FFF00000ULL,
+0x00038FFF8000ULL, 0x00000FFFC000ULL, 0x00001FFFE000ULL, 0x00001FFFE000ULL,
+0x00003FFFE000ULL, 0x00007FFFE000ULL, 0x00007FC3C000ULL, 0x0038FF07C000ULL,
+0x007FFE07C000ULL, 0x00FFFC07C000ULL, 0x01FFFC0F8000ULL, 0x01FFF80F8000ULL,
+0x01FFF00FC000ULL, 0x01E7C00FE000ULL, 0x00C38007E000ULL,
+};
+
+const uint64_t sprite_mask_18_right[35] PROGMEM = {
+0x000000600000ULL, 0x000001F80000ULL, 0x000003F80000ULL, 0x000007FC0000ULL,
+0x000007FC0000ULL, 0x000003FC0000ULL, 0x000003FC0000ULL, 0x000003FC0000ULL,
+0x000001F80000ULL, 0x000003F80000ULL, 0x00000FFE0000ULL, 0x00003FFF0000ULL,
+0x0000FFFF8000ULL, 0x0003FFFFC000ULL, 0x001FFFFFE000ULL, 0x003FFFFFE000ULL,
+0x003F87FFF000ULL, 0x003E07FFF000ULL, 0x001807FFF000ULL, 0x000007F9E000ULL,
+0x0000FFF80000ULL, 0x0001FFF80000ULL, 0x0003FFFC0000ULL, 0x0003FFFC0000ULL,
+0x0003FFFE0000ULL, 0x0003FFFF0000ULL, 0x0001E1FF0000ULL, 0x0001F07F8E00ULL,
+0x0001F03FFF00ULL, 0x0001F01FFF80ULL, 0x0000F81FFFC0ULL, 0x0000F80FFFC0ULL,
+0x0001F807FFC0ULL, 0x0003F801F3C0ULL, 0x0003F000E180ULL,
+};
+const uint64_t sprite_mask_18_left[35] PROGMEM = {
+0x000001800000ULL, 0x000007E00000ULL, 0x000007F00000ULL, 0x00000FF80000ULL,
+0x00000FF80000ULL, 0x00000FF00000ULL, 0x00000FF00000ULL, 0x00000FF00000ULL,
+0x000007E00000ULL, 0x000007F00000ULL, 0x00001FFC0000ULL, 0x00003FFF0000ULL,
+0x00007FFFC000ULL, 0x0000FFFFF000ULL, 0x0001FFFFFE00ULL, 0x0001FFFFFF00ULL,
+0x0003FFF87F00ULL, 0x0003FFF81F00ULL, 0x0003FFF80600ULL, 0x0001E7F80000ULL,
+0x000007FFC000ULL, 0x000007FFE000ULL, 0x00000FFFF000ULL, 0x00000FFFF000ULL,
+0x00001FFFF000ULL, 0x00003FFFF000ULL, 0x00003FE1E000ULL, 0x001C7F83E000ULL,
+0x003FFF03E000ULL, 0x007FFE03E000ULL, 0x00FFFE07C000ULL, 0x00FFFC07C000ULL,
+0x00FFF807E000ULL, 0x00F3E007F000ULL, 0x0061C003F000ULL,
+};
+
+const uint64_t sprite_mask_20_right[38] PROGMEM = {
+0x0001C0000000ULL, 0x0003F0000000ULL, 0x0007F0000000ULL, 0x000FF8000000ULL,
+0x000FFB800000ULL, 0x0007FFE00000ULL, 0x0007FFF00000ULL, 0x0007FFF80000ULL,
+0x0003FFFC0000ULL, 0x0001FFFE0000ULL, 0x0038FFFE0000ULL, 0x007CFFFC0000ULL,
+0x007DFFF80000ULL, 0x007FFFF00000ULL, 0x003FFFE00000ULL, 0x001FFFE00000ULL,
+0x000FDFF00000ULL, 0x00078FF80000ULL, 0x00030FF80000ULL, 0x00001FFC0000ULL,
+0x00003FFE0000ULL, 0x00007FFF0000ULL, 0x0000FFFF0000ULL, 0x0000FF3F8000ULL,
+0x0000FE1FC000ULL, 0x0000FF0FF000ULL, 0x00007F87F800ULL, 0x00001FC3FC00ULL,
+0x000007E0FE00ULL, 0x000003E07F00ULL, 0x000001E03F80ULL, 0x000001E01F80ULL,
+0x000001E00FC0ULL, 0x000000E007E0ULL, 0x000000C003E0ULL, 0x0000000001E0ULL,
+0x0000000003C0ULL, 0x0000000003C0ULL,
+};
+const uint64_t sprite_mask_20_left[38] PROGMEM = {
+0x00000000E000ULL, 0x00000003F000ULL, 0x00000003F800ULL, 0x00000007FC00ULL,
+0x00000077FC00ULL, 0x000001FFF800ULL, 0x000003FFF800ULL, 0x000007FFF800ULL,
+0x00000FFFF000ULL, 0x00001FFFE000ULL, 0x00001FFFC700ULL, 0x00000FFFCF80ULL,
+0x000007FFEF80ULL, 0x000003FFFF80ULL, 0x000001FFFF00ULL, 0x000001FFFE00ULL,
+0x000003FEFC00ULL, 0x000007FC7800ULL, 0x000007FC3000ULL, 0x00000FFE0000ULL,
+0x00001FFF0000ULL, 0x00003FFF8000ULL, 0x00003FFFC000ULL, 0x00007F3FC000ULL,
+0x0000FE1FC000ULL, 0x0003FC3FC000ULL, 0x0007F87F8000ULL, 0x000FF0FE0000ULL,
+0x001FC1F80000ULL, 0x003F81F00000ULL, 0x007F01E00000ULL, 0x007E01E00000ULL,
+0x00FC01E00000ULL, 0x01F801C00000ULL, 0x01F000C00000ULL, 0x01E000000000ULL,
+0x00F000000000ULL, 0x00F000000000ULL,
+};
+
+const uint64_t sprite_mask_21_right[37] PROGMEM = {
+0x0001C0000000ULL, 0x0003F0000000ULL, 0x0007F0000000ULL, 0x000FF8000000ULL,
+0x000FF8F80000ULL, 0x0007FFFC0000ULL, 0x0007FFFE0000ULL, 0x0007FFFE0000ULL,
+0x001BFFFF0000ULL, 0x003DFFCF0000ULL, 0x003CFFC78000ULL, 0x003DFFC78000ULL,
+0x003FFFE78000ULL, 0x001FFFE78000ULL, 0x001FFFE30000ULL, 0x001F9FF00000ULL,
+0x000F0FF80000ULL, 0x000607FC0000ULL, 0x000007FC0000ULL, 0x00000FFE01E0ULL,
+0x00001FFE07F0ULL, 0x00003FFF3FF0ULL, 0x00007FBFFFF8ULL, 0x00007F1FFFF8ULL,
+0x0000FE0FFF3CULL, 0x0000FC07F018ULL, 0x0000F8038000ULL, 0x0001F0000000ULL,
+0x0001F0000000ULL, 0x0001E0000000ULL, 0x0001E0000000ULL, 0x0001E0000000ULL,
+0x0001E0000000ULL, 0x0003E0000000ULL, 0x0007E0000000ULL, 0x001FC0000000ULL,
+0x001FC0000000ULL,
+};
+const uint64_t sprite_mask_21_left[37] PROGMEM = {
+0x00000000E000ULL, 0x00000003F000ULL, 0x00000003F800ULL, 0x00000007FC00ULL,
+0x000007C7FC00ULL, 0x00000FFFF800ULL, 0x00001FFFF800ULL, 0x00001FFFF800ULL,
+0x00003FFFF600ULL, 0x00003CFFEF00ULL, 0x000078FFCF00ULL, 0x000078FFEF00ULL,
+0x000079FFFF00ULL, 0x000079FFFE00ULL, 0x000031FFFE00ULL, 0x000003FE7E00ULL,
+0x000007FC3C00ULL, 0x00000FF81800ULL, 0x00000FF80000ULL, 0x01E01FFC0000ULL,
+0x03F81FFE0000ULL, 0x03FF3FFF0000ULL, 0x07FFFF7F8000ULL, 0x07FFFE3F8000ULL,
+0x0F3FFC1FC000ULL, 0x0603F80FC000ULL, 0x00007007C000ULL, 0x00000003E000ULL,
+0x00000003E000ULL, 0x00000001E000ULL, 0x00000001E000ULL, 0x00000001E000ULL,
+0x00000001E000ULL, 0x00000001F000ULL, 0x00000001F800ULL, 0x00000000FE00ULL,
+0x00000000FE00ULL,
+};
+
+const uint64_t sprite_mask_22_right[38] PROGMEM = {
+0x0001C0000000ULL, 0x0003F0000000ULL, 0x0007F0000000ULL, 0x000FF8000000ULL,
+0x000FF8000000ULL, 0x0007F8000000ULL, 0x0007FF000000ULL, 0x0007FF800000ULL,
+0x0003FFC00000ULL, 0x0001FFE00000ULL, 0x0000FFF00000ULL, 0x0030FFF00000ULL,
+0x0078FFF00000ULL, 0x00FFFFF00000ULL, 0x00FFFFE00000ULL, 0x007FFFC00000ULL,
+0x001FFF800000ULL, 0x0003BF800000ULL, 0x00003FC00000ULL, 0x00003FE00000ULL,
+0x00003FE00000ULL, 0x00003FE03800ULL, 0x00001FF0FC00ULL, 0x00001FFFFE00ULL,
+0x00001FFFFE00ULL, 0x00001FFFFF00ULL, 0x00001FFFEF00ULL, 0x00000FFE0600ULL,
+0x000007F00000ULL, 0x000007E00000ULL, 0x000003C00000ULL, 0x000003C00000ULL,
+0x000003E00000ULL, 0x000003E00000ULL, 0x000001E00000ULL, 0x000003E00000ULL,
+0x00000FE00000ULL, 0x00000FE00000ULL,
+};
+const uint64_t sprite_mask_22_left[38] PROGMEM = {
+0x00000000E000ULL, 0x00000003F000ULL, 0x00000003F800ULL, 0x00000007FC00ULL,
+0x00000007FC00ULL, 0x00000007F800ULL, 0x0000003FF800ULL, 0x0000007FF800ULL,
+0x000000FFF000ULL, 0x000001FFE000ULL, 0x000003FFC000ULL, 0x000003FFC300ULL,
+0x000003FFC780ULL, 0x000003FFFFC0ULL, 0x000001FFFFC0ULL, 0x000000FFFF80ULL,
+0x0000007FFE00ULL, 0x0000007F7000ULL, 0x000000FF0000ULL, 0x000001FF0000ULL,
+0x000001FF0000ULL, 0x000701FF0000ULL, 0x000FC3FE0000ULL, 0x001FFFFE0000ULL,
+0x001FFFFE0000ULL, 0x003FFFFE0000ULL, 0x003DFFFE0000ULL, 0x00181FFC0000ULL,
+0x000003F80000ULL, 0x000001F80000ULL, 0x000000F00000ULL, 0x000000F00000ULL,
+0x000001F00000ULL, 0x000001F00000ULL, 0x000001E00000ULL, 0x000001F00000ULL,
+0x000001FC0000ULL, 0x000001FC0000ULL,
+};
+
+const uint64_t sprite_mask_23_right[38] PROGMEM = {
+0x0000E0000000ULL, 0x0001F8000000ULL, 0x0003F8000000ULL, 0x0007FC000000ULL,
+0x0007FC000000ULL, 0x0003FC000000ULL, 0x0003FC000000ULL, 0x0003FF000000ULL,
+0x0001FF800000ULL, 0x0000FFC00000ULL, 0x00003FC00000ULL, 0x00003FC00000ULL,
+0x00003FE00000ULL, 0x0001FFE00000ULL, 0x0003FFE00000ULL, 0x0003FFE00000ULL,
+0x0003FFF00000ULL, 0x0001FFF80000ULL, 0x00007FFC0000ULL, 0x00003BFC0000ULL,
+0x000003FC0000ULL, 0x000003FF8000ULL, 0x000003FFC000ULL, 0x000007FFC000ULL,
+0x000007FFE000ULL, 0x000007FFE000ULL, 0x000007FFE000ULL, 0x000003FFC000ULL,
+0x0000000F8000ULL, 0x000000078000ULL, 0x00000007C000ULL, 0x00000007C000ULL,
+0x00000003E000ULL, 0x00000003E000ULL, 0x00000001F000ULL, 0x00000003F000ULL,
+0x00000007F000ULL, 0x00000007E000ULL,
+};
+const uint64_t sprite_mask_23_left[38] PROGMEM = {
+0x00000001C000ULL, 0x00000007E000ULL, 0x00000007F000ULL, 0x0000000FF800ULL,
+0x0000000FF800ULL, 0x0000000FF000ULL, 0x0000000FF000ULL, 0x0000003FF000ULL,
+0x0000007FE000ULL, 0x000000FFC000ULL, 0x000000FF0000ULL, 0x000000FF0000ULL,
+0x000001FF0000ULL, 0x000001FFE000ULL, 0x000001FFF000ULL, 0x000001FFF000ULL,
+0x000003FFF000ULL, 0x000007FFE000ULL, 0x00000FFF8000ULL, 0x00000FF70000ULL,
+0x00000FF00000ULL, 0x00007FF00000ULL, 0x0000FFF00000ULL, 0x0000FFF80000ULL,
+0x0001FFF80000ULL, 0x0001FFF80000ULL, 0x0001FFF80000ULL, 0x0000FFF00000ULL,
+0x00007C000000ULL, 0x000078000000ULL, 0x0000F8000000ULL, 0x0000F8000000ULL,
+0x0001F0000000ULL, 0x0001F0000000ULL, 0x0003E0000000ULL, 0x0003F0000000ULL,
+0x0003F8000000ULL, 0x0001F8000000ULL,
+};
+
+const uint64_t sprite_mask_24_right[38] PROGMEM = {
+0x0000E0000000ULL, 0x0001F8000000ULL, 0x0003F8000000ULL, 0x0007FC000000ULL,
+0x0007FC000000ULL, 0x0003FC000000ULL, 0x0003FF800000ULL, 0x0003FFE00000ULL,
+0x0001FFF00000ULL, 0x0000FFF80000ULL, 0x0000FFFC0000ULL, 0x0019FFFC0000ULL,
+0x003DFFFC0000ULL, 0x003FFFFC0000ULL, 0x003FFFF80000ULL, 0x001FFFF00000ULL,
+0x000FFFF00000ULL, 0x0003EFF80000ULL, 0x0000CFF80000ULL, 0x00000FFC0000ULL,
+0x00001FFE0000ULL, 0x00003FFF0000ULL, 0x00007FFF0000ULL, 0x0000FF3F8000ULL,
+0x0000FC1FC000ULL, 0x0000FF0FE000ULL, 0x00007FE7F000ULL, 0x00001FF3F800ULL,
+0x000007F0FE00ULL, 0x000001F07F00ULL, 0x000000F03F80ULL, 0x000000F00FC0ULL,
+0x000000E007E0ULL, 0x0000006003E0ULL, 0x0000000001E0ULL, 0x0000000001E0ULL,
+0x0000000003C0ULL, 0x000000000380ULL,
+};
+const uint64_t sprite_mask_24_left[38] PROGMEM = {
+0x00000001C000ULL, 0x00000007E000ULL, 0x00000007F000ULL, 0x0000000FF800ULL,
+0x0000000FF800ULL, 0x0000000FF000ULL, 0x0000007FF000ULL, 0x000001FFF000ULL,
+0x000003FFE000ULL, 0x000007FFC000ULL, 0x00000FFFC000ULL, 0x00000FFFE600ULL,
+0x00000FFFEF00ULL, 0x00000FFFFF00ULL, 0x000007FFFF00ULL, 0x000003FFFE00ULL,
+0x000003FFFC00ULL, 0x000007FDF000ULL, 0x000007FCC000ULL, 0x00000FFC0000ULL,
+0x00001FFE0000ULL, 0x00003FFF0000ULL, 0x00003FFF8000ULL, 0x00007F3FC000ULL,
+0x0000FE0FC000ULL, 0x0001FC3FC000ULL, 0x0003F9FF8000ULL, 0x0007F3FE0000ULL,
+0x001FC3F80000ULL, 0x003F83E00000ULL, 0x007F03C00000ULL, 0x00FC03C00000ULL,
+0x01F801C00000ULL, 0x01F001800000ULL, 0x01E000000000ULL, 0x01E000000000ULL,
+0x00F000000000ULL, 0x007000000000ULL,
+};
+
+const uint64_t sprite_mask_25_right[37] PROGMEM = {
+0x0001C0000000ULL, 0x0003F0000000ULL, 0x0007F0000000ULL, 0x000FF8000000ULL,
+0x000FFBE00000ULL, 0x0007FFFC0000ULL, 0x0007FFFE0000ULL, 0x0007FFFF0000ULL,
+0x0003FFFF0000ULL, 0x0039FFDE0000ULL, 0x007CFFFE0000ULL, 0x007DFFFC0000ULL,
+0x007FFFF80000ULL, 0x003FFFF80000ULL, 0x003FFFF00000ULL, 0x001FCFF80000ULL,
+0x000F87FC0000ULL, 0x000703FE0000ULL, 0x000003FF0000ULL, 0x000007FF00E0ULL,
+0x00000FFF87F0ULL, 0x00001FFF9FF8ULL, 0x00003FCFFFFCULL, 0x00003F87FFFCULL,
+0x00007F03FFFCULL, 0x00007E01FC18ULL, 0x00007C006000ULL, 0x000078000000ULL,
+0x000078000000ULL, 0x000078000000ULL, 0x0000F8000000ULL, 0x0000F8000000ULL,
+0x0001F0000000ULL, 0x0003F0000000ULL, 0x0007F0000000ULL, 0x000FF0000000ULL,
+0x000FE0000000ULL,
+};
+const uint64_t sprite_mask_25_left[37] PROGMEM = {
+0x00000000E000ULL, 0x00000003F000ULL, 0x00000003F800ULL, 0x00000007FC00ULL,
+0x000001F7FC00ULL, 0x00000FFFF800ULL, 0x00001FFFF800ULL, 0x00003FFFF800ULL,
+0x00003FFFF000ULL, 0x00001EFFE700ULL, 0x00001FFFCF80ULL, 0x00000FFFEF80ULL,
+0x000007FFFF80ULL, 0x000007FFFF00ULL, 0x000003FFFF00ULL, 0x000007FCFE00ULL,
+0x00000FF87C00ULL, 0x00001FF03800ULL, 0x00003FF00000ULL, 0x01C03FF80000ULL,
+0x03F87FFC0000ULL, 0x07FE7FFE0000ULL, 0x0FFFFCFF0000ULL, 0x0FFFF87F0000ULL,
+0x0FFFF03F8000ULL, 0x060FE01F8000ULL, 0x0001800F8000ULL, 0x000000078000ULL,
+0x000000078000ULL, 0x000000078000ULL, 0x00000007C000ULL, 0x00000007C000ULL,
+0x00000003E000ULL, 0x00000003F000ULL, 0x00000003F800ULL, 0x00000003FC00ULL,
+0x00000001FC00ULL,
+};
+
+const uint64_t sprite_mask_26_right[38] PROGMEM = {
+0x0001C0000000ULL, 0x0003F0000000ULL, 0x0007F0000000ULL, 0x000FF8000000ULL,
+0x000FF8000000ULL, 0x0007F8000000ULL, 0x0007F8000000ULL, 0x0007FC000000ULL,
+0x0003FE000000ULL, 0x0001FF000000ULL, 0x00007F800000ULL, 0x00007FC00000ULL,
+0x00007FC00000ULL, 0x00037FE00000ULL, 0x0007FFE00000ULL, 0x0007FFE00000ULL,
+0x0007FFF00000ULL, 0x0003FFF00000ULL, 0x00007FF00000ULL, 0x000037F00000ULL,
+0x000007F03000ULL, 0x000007F8F800ULL, 0x000007F9F800ULL, 0x000007FFFC00ULL,
+0x000007FFFC00ULL, 0x000007FFFE00ULL, 0x000003FF9E00ULL, 0x000003FE0C00ULL,
+0x000001F80000ULL, 0x000001F00000ULL, 0x000001F00000ULL, 0x000001F80000ULL,
+0x000000F80000ULL, 0x000000F80000ULL, 0x000000FC0000ULL, 0x000001FC0000ULL,
+0x000003FC0000ULL, 0x000003FC0000ULL,
+};
+const uint64_t sprite_mask_26_left[38] PROGMEM = {
+0x00000000E000ULL, 0x00000003F000ULL, 0x00000003F800ULL, 0x00000007FC00ULL,
+0x00000007FC00ULL, 0x00000007F800ULL, 0x00000007F800ULL, 0x0000000FF800ULL,
+0x0000001FF000ULL, 0x0000003FE000ULL, 0x0000007F8000ULL, 0x000000FF8000ULL,
+0x000000FF8000ULL, 0x000001FFB000ULL, 0x000001FFF800ULL, 0x000001FFF800ULL,
+0x000003FFF800ULL, 0x000003FFF000ULL, 0x000003FF8000ULL, 0x000003FB0000ULL,
+0x000303F80000ULL, 0x0007C7F80000ULL, 0x0007E7F80000ULL, 0x000FFFF80000ULL,
+0x000FFFF80000ULL, 0x001FFFF80000ULL, 0x001E7FF00000ULL, 0x000C1FF00000ULL,
+0x000007E00000ULL, 0x000003E00000ULL, 0x000003E00000ULL, 0x000007E00000ULL,
+0x000007C00000ULL, 0x000007C00000ULL, 0x00000FC00000ULL, 0x00000FE00000ULL,
+0x00000FF00000ULL, 0x00000FF00000ULL,
+};
+
+const uint64_t sprite_mask_27_right[38] PROGMEM = {
+0x0000E0000000ULL, 0x0001F8000000ULL, 0x0003F8000000ULL, 0x0007FC000000ULL,
+0x0007FC000000ULL, 0x0003FC000000ULL, 0x0003FFC00000ULL, 0x0003FFF00000ULL,
+0x0001FFF80000ULL, 0x0000FFFC0000ULL, 0x00033FFE0000ULL, 0x0007BFFE0000ULL,
+0x0007FFFC0000ULL, 0x0007FFF80000ULL, 0x0003FFF00000ULL, 0x0000FFF00000ULL,
+0x00003FF80000ULL, 0x000003FC0000ULL, 0x000003FC0000ULL, 0x000003FC0000ULL,
+0x000003FC6000ULL, 0x000003FFF000ULL, 0x000007FFF000ULL, 0x000007FFF800ULL,
+0x000007FFF800ULL, 0x000007FFF800ULL, 0x000003FF3800ULL, 0x0000001F9800ULL,
+0x0000001F8000ULL, 0x0000000FC000ULL, 0x00000007C000ULL, 0x00000007C000ULL,
+0x00000003E000ULL, 0x00000003E000ULL, 0x00000001F000ULL, 0x00000003F000ULL,
+0x00000007F000ULL, 0x00000007F000ULL,
+};
+const uint64_t sprite_mask_27_left[38] PROGMEM = {
+0x00000001C000ULL, 0x00000007E000ULL, 0x00000007F000ULL, 0x0000000FF800ULL,
+0x0000000FF800ULL, 0x0000000FF000ULL, 0x000000FFF000ULL, 0x000003FFF000ULL,
+0x000007FFE000ULL, 0x00000FFFC000ULL, 0x00001FFF3000ULL, 0x00001FFF7800ULL,
+0x00000FFFF800ULL, 0x000007FFF800ULL, 0x000003FFF000ULL, 0x000003FFC000ULL,
+0x000007FF0000ULL, 0x00000FF00000ULL, 0x00000FF00000ULL, 0x00000FF00000ULL,
+0x00018FF00000ULL, 0x0003FFF00000ULL, 0x0003FFF80000ULL, 0x0007FFF80000ULL,
+0x0007FFF80000ULL, 0x0007FFF80000ULL, 0x00073FF00000ULL, 0x00067E000000ULL,
+0x00007E000000ULL, 0x0000FC000000ULL, 0x0000F8000000ULL, 0x0000F8000000ULL,
+0x0001F0000000ULL, 0x0001F0000000ULL, 0x0003E0000000ULL, 0x0003F0000000ULL,
+0x0003F8000000ULL, 0x0003F8000000ULL,
+};
+
+// { x, y, w, h, right, left } - the box is in the right-facing cell
+const FrameMask fighter_masks[28] = {
+    { 12,  3, 22, 45, sprite_mask_00_right, sprite_mask_00_left },
+    {  6, 18, 28, 30, sprite_mask_01_right, sprite_mask_01_left },
+    {  8,  4, 29, 44, sprite_mask_02_right, sprite_mask_02_left },
+    {  8,  4, 33, 44, sprite_mask_03_right, sprite_mask_03_left },
+    {  9,  4, 29, 44, sprite_mask_04_right, sprite_mask_04_left },
+    {  0,  0,  0,  0, sprite_mask_empty, sprite_mask_empty },
+    {  0,  0,  0,  0, sprite_mask_empty, sprite_mask_empty },
+    { 12,  4, 21, 44, sprite_mask_07_right, sprite_mask_07_left },
+    {  8,  8, 30, 41, sprite_mask_08_right, sprite_mask_08_left },
+    {  0,  0,  0,  0, sprite_mask_empty, sprite_mask_empty },
+    {  0,  0,  0,  0, sprite_mask_empty, sprite_mask_empty },
+    {  0,  0,  0,  0, sprite_mask_empty, sprite_mask_empty },
+    {  0,  0,  0,  0, sprite_mask_empty, sprite_mask_empty },
+    {  0,  0,  0,  0, sprite_mask_empty, sprite_mask_empty },
+    {  5, 13, 39, 29, sprite_mask_14_right, sprite_mask_14_left },
+    {  6, 30, 39, 18, sprite_mask_15_right, sprite_mask_15_left },
+    {  6, 13, 28, 35, sprite_mask_16_right, sprite_mask_16_left },
+    {  5, 13, 37, 35, sprite_mask_17_right, sprite_mask_17_left },
+    {  6, 13, 32, 35, sprite_mask_18_right, sprite_mask_18_left },
+    {  0,  0,  0,  0, sprite_mask_empty, sprite_mask_empty },
+    {  5, 10, 34, 38, sprite_mask_20_right, sprite_mask_20_left },
+    {  2, 11, 36, 37, sprite_mask_21_right, sprite_mask_21_left },
+    {  8, 10, 32, 38, sprite_mask_22_right, sprite_mask_22_left },
+    { 12, 10, 23, 38, sprite_mask_23_right, sprite_mask_23_left },
+    {  5, 10, 33, 38, sprite_mask_24_right, sprite_mask_24_left },
+    {  2, 11, 37, 37, sprite_mask_25_right, sprite_mask_25_left },
+    {  9, 10, 27, 38, sprite_mask_26_right, sprite_mask_26_left },
+    { 11, 10, 24, 38, sprite_mask_27_right, sprite_mask_27_left },
+};
@@ -0,0 +1,627 @@
+#pragma once
+
+// Generated by  : tools/gen_sprites.py - do not edit by hand
+// Generated from: sprite_right_{red,blue}_NN.h
+// Dimensions    : 46x50 pixels, right facing
+//
+// Span-encoded, palette-indexed sprite frames shared by every fighter colour.
+// Each frame is trimmed to the box around its opaque pixels. For each row of
+// the trimmed box:
+//   span count
+//   per span: columns skipped, run length, then the run's 4-bit palette
+//             indices packed two per byte (high nibble first)
+// Unused frames have an empty box.
+
+#define SPRITE_PALETTE_SIZE 16
+
+const unsigned short sprite_palette_red[SPRITE_PALETTE_SIZE] PROGMEM = { 0x2106, 0x4147, 0x4147, 0x61C6, 0x83F0, 0x8AA7, 0xA986, 0xDAAC, 0xDB84, 0xEE13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
+const unsigned short sprite_palette_blue[SPRITE_PALETTE_SIZE] PROGMEM = { 0x2106, 0x39EE, 0x4147, 0x61C6, 0x83F0, 0x8AA7, 0x5B7C, 0xCEDF, 0xDB84, 0xEE13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
+
+const uint8_t sprite_spans_empty[1] PROGMEM = { 0 };
+
+// Frame 0: trimmed to 22x45 at (12, 3)
+const uint8_t sprite_spans_00[471] PROGMEM = {
+0x01, 0x0A, 0x02, 0x00, 0x01, 0x08, 0x06, 0x00, 0x22, 0x00, 0x01, 0x08, 0x07, 0x09, 0x39, 0x32,
+0x00, 0x01, 0x07, 0x09, 0x02, 0x39, 0x32, 0x32, 0x00, 0x01, 0x07, 0x09, 0x03, 0x22, 0x22, 0x22,
+0x00, 0x01, 0x07, 0x08, 0x02, 0x28, 0x88, 0x80, 0x01, 0x07, 0x08, 0x02, 0x88, 0x99, 0x90, 0x01,
+0x07, 0x08, 0x00, 0x89, 0x99, 0x90, 0x01, 0x08, 0x06, 0x08, 0x99, 0x80, 0x01, 0x07, 0x06, 0x05,
+0x99, 0x80, 0x01, 0x05, 0x0A, 0x00, 0x88, 0x88, 0x85, 0x00, 0x01, 0x04, 0x0C, 0x08, 0x99, 0x98,
+0x88, 0x88, 0x50, 0x01, 0x03, 0x0E, 0x09, 0x99, 0x99, 0x99, 0x88, 0x89, 0x80, 0x01, 0x02, 0x10,
+0x08, 0x99, 0x88, 0x99, 0x99, 0x89, 0x99, 0x50, 0x01, 0x02, 0x10, 0x09, 0x98, 0x58, 0x99, 0x99,
+0x89, 0x98, 0x50, 0x01, 0x01, 0x12, 0x08, 0x99, 0x80, 0x58, 0x98, 0x88, 0x88, 0x58, 0x50, 0x02,
+0x01, 0x05, 0x09, 0x98, 0x00, 0x01, 0x0C, 0x05, 0x89, 0x88, 0x89, 0x08, 0x80, 0x02, 0x01, 0x04,
+0x09, 0x80, 0x03, 0x0C, 0x08, 0x99, 0x89, 0x90, 0x58, 0x50, 0x02, 0x01, 0x04, 0x09, 0x80, 0x03,
+0x0C, 0x08, 0x99, 0x89, 0x90, 0x58, 0x80, 0x02, 0x00, 0x05, 0x09, 0x88, 0x00, 0x03, 0x0D, 0x08,
+0x99, 0x89, 0x90, 0x05, 0x88, 0x00, 0x03, 0x00, 0x04, 0x09, 0x80, 0x04, 0x08, 0x08, 0x89, 0x89,
+0x80, 0x01, 0x04, 0x08, 0x80, 0x03, 0x00, 0x04, 0x09, 0x80, 0x04, 0x08, 0x00, 0x00, 0x40, 0x00,
+0x01, 0x04, 0x05, 0x80, 0x03, 0x00, 0x04, 0x09, 0x80, 0x03, 0x09, 0x06, 0x61, 0x11, 0x11, 0x00,
+0x02, 0x04, 0x08, 0x50, 0x03, 0x00, 0x04, 0x08, 0x80, 0x03, 0x09, 0x06, 0x76, 0x11, 0x61, 0x00,
+0x02, 0x04, 0x09, 0x80, 0x03, 0x00, 0x05, 0x09, 0x88, 0x00, 0x02, 0x09, 0x07, 0x76, 0x61, 0x66,
+0x00, 0x01, 0x05, 0x08, 0x89, 0x00, 0x03, 0x00, 0x05, 0x09, 0x98, 0x00, 0x02, 0x09, 0x07, 0x76,
+0x10, 0x66, 0x00, 0x01, 0x05, 0x05, 0x88, 0x00, 0x03, 0x01, 0x03, 0x00, 0x00, 0x03, 0x09, 0x07,
+0x76, 0x10, 0x66, 0x00, 0x02, 0x03, 0x00, 0x00, 0x01, 0x06, 0x0A, 0x06, 0x76, 0x60, 0x11, 0x60,
+0x01, 0x06, 0x0A, 0x07, 0x76, 0x10, 0x11, 0x10, 0x01, 0x06, 0x0A, 0x07, 0x76, 0x00, 0x11, 0x60,
+0x02, 0x06, 0x04, 0x07, 0x60, 0x01, 0x05, 0x01, 0x66, 0x00, 0x02, 0x06, 0x04, 0x06, 0x10, 0x01,
+0x04, 0x01, 0x60, 0x02, 0x05, 0x05, 0x01, 0x11, 0x00, 0x01, 0x04, 0x01, 0x10, 0x02, 0x05, 0x04,
+0x01, 0x10, 0x02, 0x04, 0x01, 0x10, 0x02, 0x05, 0x04, 0x01, 0x10, 0x01, 0x05, 0x01, 0x11, 0x00,
+0x02, 0x05, 0x04, 0x01, 0x10, 0x01, 0x05, 0x01, 0x16, 0x00, 0x02, 0x04, 0x05, 0x01, 0x11, 0x00,
+0x01, 0x05, 0x01, 0x16, 0x00, 0x02, 0x04, 0x05, 0x01, 0x11, 0x00, 0x01, 0x04, 0x01, 0x10, 0x02,
+0x04, 0x04, 0x01, 0x10, 0x02, 0x04, 0x01, 0x10, 0x02, 0x03, 0x05, 0x01, 0x11, 0x00, 0x02, 0x04,
+0x01, 0x10, 0x02, 0x03, 0x05, 0x01, 0x11, 0x00, 0x02, 0x04, 0x01, 0x10, 0x02, 0x03, 0x05, 0x06,
+0x61, 0x00, 0x02, 0x04, 0x06, 0x60, 0x02, 0x03, 0x05, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00,
+0x00, 0x02, 0x02, 0x06, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x02, 0x02, 0x06, 0x00,
+0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00,
+};
+
+// Frame 1: trimmed to 28x30 at (6, 18)
+const uint8_t sprite_spans_01[350] PROGMEM = {
+0x01, 0x11, 0x02, 0x00, 0x01, 0x0F, 0x06, 0x00, 0x22, 0x00, 0x01, 0x0F, 0x07, 0x09, 0x39, 0x32,
+0x00, 0x01, 0x0E, 0x09, 0x02, 0x39, 0x32, 0x32, 0x00, 0x01, 0x0E, 0x09, 0x03, 0x22, 0x22, 0x22,
+0x00, 0x01, 0x0E, 0x08, 0x02, 0x28, 0x88, 0x80, 0x01, 0x0E, 0x08, 0x02, 0x88, 0x99, 0x90, 0x01,
+0x0E, 0x08, 0x00, 0x89, 0x99, 0x90, 0x01, 0x0D, 0x0A, 0x00, 0x58, 0x99, 0x80, 0x50, 0x01, 0x0B,
+0x0D, 0x00, 0x99, 0x88, 0x00, 0x05, 0x88, 0x00, 0x01, 0x0A, 0x0F, 0x08, 0x99, 0x99, 0x98, 0x88,
+0x88, 0x89, 0x00, 0x01, 0x0A, 0x10, 0x09, 0x99, 0x89, 0x99, 0x98, 0x55, 0x89, 0x90, 0x01, 0x09,
+0x11, 0x08, 0x99, 0x80, 0x89, 0x99, 0x80, 0x05, 0x98, 0x00, 0x02, 0x09, 0x0C, 0x08, 0x98, 0x50,
+0x89, 0x88, 0x50, 0x01, 0x05, 0x08, 0x88, 0x00, 0x02, 0x09, 0x0B, 0x09, 0x98, 0x05, 0x89, 0x98,
+0x00, 0x01, 0x06, 0x08, 0x09, 0x90, 0x01, 0x09, 0x12, 0x09, 0x98, 0x08, 0x89, 0x85, 0x00, 0x09,
+0x90, 0x80, 0x01, 0x09, 0x13, 0x09, 0x98, 0x05, 0x88, 0x50, 0x61, 0x08, 0x90, 0x01, 0x00, 0x01,
+0x09, 0x13, 0x08, 0x99, 0x00, 0x04, 0x06, 0x61, 0x08, 0x80, 0x11, 0x00, 0x01, 0x09, 0x13, 0x08,
+0x99, 0x01, 0x16, 0x66, 0x11, 0x10, 0x01, 0x16, 0x00, 0x01, 0x0A, 0x12, 0x08, 0x90, 0x11, 0x11,
+0x11, 0x11, 0x11, 0x11, 0x60, 0x01, 0x0A, 0x12, 0x09, 0x80, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11,
+0x60, 0x02, 0x09, 0x0B, 0x00, 0x98, 0x50, 0x10, 0x00, 0x00, 0x03, 0x04, 0x01, 0x10, 0x03, 0x03,
+0x04, 0x00, 0x00, 0x02, 0x07, 0x00, 0x98, 0x80, 0x00, 0x06, 0x05, 0x01, 0x11, 0x00, 0x02, 0x02,
+0x0E, 0x00, 0x77, 0x10, 0x01, 0x09, 0x98, 0x00, 0x06, 0x05, 0x01, 0x16, 0x00, 0x02, 0x01, 0x0E,
+0x00, 0x06, 0x16, 0x77, 0x60, 0x89, 0x80, 0x07, 0x05, 0x01, 0x16, 0x00, 0x02, 0x01, 0x0E, 0x00,
+0x66, 0x11, 0x66, 0x66, 0x08, 0x80, 0x06, 0x05, 0x01, 0x11, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00,
+0x11, 0x11, 0x66, 0x60, 0x99, 0x80, 0x05, 0x05, 0x01, 0x66, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00,
+0x00, 0x11, 0x11, 0x60, 0x99, 0x90, 0x05, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00,
+0x00, 0x01, 0x0A, 0x01, 0x11, 0x10, 0x88, 0x90, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01,
+0x03, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x00,
+};
+
+// Frame 2: trimmed to 29x44 at (8, 4)
+const uint8_t sprite_spans_02[431] PROGMEM = {
+0x01, 0x0A, 0x02, 0x00, 0x01, 0x08, 0x06, 0x00, 0x22, 0x00, 0x01, 0x08, 0x07, 0x09, 0x39, 0x32,
+0x00, 0x01, 0x07, 0x09, 0x02, 0x39, 0x32, 0x32, 0x00, 0x01, 0x07, 0x09, 0x03, 0x22, 0x22, 0x22,
+0x00, 0x01, 0x07, 0x08, 0x02, 0x28, 0x88, 0x80, 0x01, 0x07, 0x08, 0x02, 0x88, 0x99, 0x90, 0x01,
+0x07, 0x09, 0x00, 0x89, 0x99, 0x00, 0x00, 0x01, 0x08, 0x09, 0x05, 0x99, 0x09, 0x98, 0x00, 0x01,
+0x08, 0x0B, 0x00, 0x88, 0x08, 0x89, 0x80, 0x00, 0x01, 0x07, 0x0E, 0x09, 0x89, 0x80, 0x58, 0x98,
+0x89, 0x00, 0x01, 0x06, 0x10, 0x09, 0x89, 0x99, 0x80, 0x00, 0x58, 0x89, 0x90, 0x01, 0x06, 0x10,
+0x08, 0x89, 0x99, 0x98, 0x55, 0x00, 0x88, 0x80, 0x01, 0x06, 0x10, 0x08, 0x59, 0x98, 0x99, 0x85,
+0x55, 0x58, 0x80, 0x01, 0x06, 0x0F, 0x08, 0x59, 0x98, 0x99, 0x95, 0x00, 0x00, 0x00, 0x01, 0x06,
+0x0C, 0x08, 0x08, 0x88, 0x88, 0x88, 0x50, 0x01, 0x02, 0x0F, 0x00, 0x00, 0x58, 0x09, 0x88, 0x89,
+0x98, 0x00, 0x01, 0x01, 0x10, 0x09, 0x50, 0x58, 0x80, 0x89, 0x89, 0x99, 0x80, 0x01, 0x01, 0x10,
+0x09, 0x85, 0x08, 0x50, 0x09, 0x89, 0x99, 0x80, 0x02, 0x01, 0x07, 0x09, 0x80, 0x00, 0x00, 0x01,
+0x08, 0x09, 0x89, 0x98, 0x80, 0x02, 0x02, 0x03, 0x00, 0x00, 0x04, 0x08, 0x08, 0x88, 0x88, 0x50,
+0x01, 0x09, 0x08, 0x00, 0x04, 0x00, 0x00, 0x01, 0x09, 0x08, 0x01, 0x11, 0x11, 0x10, 0x01, 0x08,
+0x09, 0x01, 0x66, 0x16, 0x66, 0x00, 0x01, 0x07, 0x0B, 0x01, 0x66, 0x61, 0x67, 0x76, 0x00, 0x01,
+0x07, 0x0B, 0x06, 0x66, 0x11, 0x16, 0x77, 0x00, 0x01, 0x06, 0x0D, 0x06, 0x66, 0x10, 0x01, 0x67,
+0x76, 0x00, 0x01, 0x06, 0x0D, 0x06, 0x61, 0x00, 0x00, 0x16, 0x77, 0x00, 0x02, 0x05, 0x06, 0x06,
+0x61, 0x10, 0x02, 0x07, 0x01, 0x67, 0x76, 0x00, 0x02, 0x05, 0x05, 0x06, 0x11, 0x00, 0x04, 0x06,
+0x01, 0x67, 0x70, 0x02, 0x05, 0x05, 0x06, 0x11, 0x00, 0x05, 0x06, 0x06, 0x67, 0x60, 0x02, 0x04,
+0x05, 0x06, 0x11, 0x00, 0x07, 0x06, 0x00, 0x66, 0x10, 0x02, 0x04, 0x05, 0x01, 0x11, 0x00, 0x08,
+0x05, 0x01, 0x11, 0x00, 0x02, 0x03, 0x05, 0x01, 0x11, 0x00, 0x0A, 0x05, 0x01, 0x11, 0x00, 0x02,
+0x03, 0x05, 0x01, 0x11, 0x00, 0x0A, 0x05, 0x01, 0x66, 0x00, 0x02, 0x03, 0x05, 0x01, 0x11, 0x00,
+0x0B, 0x05, 0x01, 0x66, 0x00, 0x02, 0x03, 0x05, 0x01, 0x11, 0x00, 0x0C, 0x05, 0x06, 0x61, 0x00,
+0x02, 0x03, 0x05, 0x01, 0x11, 0x00, 0x0C, 0x05, 0x01, 0x66, 0x00, 0x02, 0x03, 0x05, 0x01, 0x11,
+0x00, 0x0D, 0x05, 0x01, 0x66, 0x00, 0x02, 0x02, 0x06, 0x01, 0x11, 0x10, 0x0D, 0x05, 0x01, 0x16,
+0x00, 0x02, 0x02, 0x06, 0x06, 0x61, 0x10, 0x0D, 0x06, 0x00, 0x16, 0x60, 0x02, 0x01, 0x06, 0x00,
+0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x10, 0x06,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0x00,
+};
+
+// Frame 3: trimmed to 33x44 at (8, 4)
+const uint8_t sprite_spans_03[455] PROGMEM = {
+0x01, 0x0B, 0x02, 0x00, 0x01, 0x09, 0x06, 0x00, 0x22, 0x00, 0x01, 0x09, 0x07, 0x09, 0x39, 0x32,
+0x00, 0x01, 0x08, 0x09, 0x02, 0x39, 0x32, 0x32, 0x00, 0x01, 0x08, 0x09, 0x03, 0x22, 0x22, 0x22,
+0x00, 0x01, 0x08, 0x08, 0x02, 0x28, 0x88, 0x80, 0x01, 0x08, 0x08, 0x02, 0x88, 0x99, 0x90, 0x01,
+0x08, 0x08, 0x00, 0x89, 0x99, 0x90, 0x01, 0x09, 0x06, 0x05, 0x99, 0x90, 0x01, 0x08, 0x0B, 0x00,
+0x08, 0x85, 0x50, 0x00, 0x00, 0x01, 0x07, 0x13, 0x09, 0x89, 0x88, 0x88, 0x89, 0x98, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x06, 0x1A, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x00,
+0x00, 0x00, 0x01, 0x06, 0x1B, 0x09, 0x89, 0x99, 0x99, 0x99, 0x99, 0x89, 0x99, 0x89, 0x99, 0x99,
+0x99, 0x98, 0x00, 0x01, 0x06, 0x1B, 0x09, 0x89, 0x99, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x99, 0x00, 0x01, 0x06, 0x1B, 0x09, 0x58, 0x99, 0x89, 0x99, 0x85, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x05, 0x88, 0x00, 0x02, 0x06, 0x0C, 0x09, 0x08, 0x88, 0x88, 0x88, 0x50, 0x0B, 0x03,
+0x00, 0x00, 0x01, 0x03, 0x0E, 0x00, 0x05, 0x80, 0x89, 0x88, 0x89, 0x80, 0x01, 0x02, 0x0F, 0x09,
+0x50, 0x88, 0x50, 0x99, 0x89, 0x98, 0x00, 0x01, 0x02, 0x0F, 0x09, 0x85, 0x58, 0x50, 0x99, 0x89,
+0x98, 0x00, 0x01, 0x02, 0x0F, 0x09, 0x88, 0x00, 0x00, 0x89, 0x89, 0x88, 0x00, 0x02, 0x03, 0x03,
+0x00, 0x00, 0x03, 0x08, 0x08, 0x88, 0x88, 0x80, 0x01, 0x09, 0x08, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x09, 0x08, 0x01, 0x11, 0x11, 0x10, 0x01, 0x08, 0x09, 0x01, 0x66, 0x16, 0x66, 0x00, 0x01, 0x07,
+0x0B, 0x01, 0x66, 0x61, 0x66, 0x76, 0x00, 0x01, 0x07, 0x0B, 0x06, 0x76, 0x11, 0x16, 0x77, 0x00,
+0x01, 0x06, 0x0D, 0x01, 0x76, 0x10, 0x01, 0x66, 0x76, 0x00, 0x01, 0x06, 0x0D, 0x06, 0x76, 0x00,
+0x00, 0x66, 0x77, 0x00, 0x02, 0x05, 0x06, 0x06, 0x76, 0x10, 0x02, 0x07, 0x01, 0x66, 0x76, 0x00,
+0x02, 0x05, 0x05, 0x06, 0x61, 0x00, 0x04, 0x06, 0x01, 0x67, 0x70, 0x02, 0x05, 0x05, 0x06, 0x11,
+0x00, 0x05, 0x06, 0x06, 0x66, 0x60, 0x02, 0x04, 0x05, 0x06, 0x11, 0x00, 0x07, 0x06, 0x00, 0x66,
+0x10, 0x02, 0x04, 0x05, 0x01, 0x11, 0x00, 0x08, 0x05, 0x01, 0x11, 0x00, 0x02, 0x03, 0x05, 0x01,
+0x11, 0x00, 0x0A, 0x05, 0x01, 0x11, 0x00, 0x02, 0x03, 0x05, 0x01, 0x11, 0x00, 0x0A, 0x05, 0x01,
+0x16, 0x00, 0x02, 0x03, 0x05, 0x01, 0x11, 0x00, 0x0B, 0x05, 0x01, 0x66, 0x00, 0x02, 0x03, 0x05,
+0x01, 0x11, 0x00, 0x0C, 0x05, 0x06, 0x61, 0x00, 0x02, 0x03, 0x05, 0x01, 0x11, 0x00, 0x0C, 0x05,
+0x01, 0x16, 0x00, 0x02, 0x03, 0x05, 0x01, 0x11, 0x00, 0x0D, 0x05, 0x01, 0x66, 0x00, 0x02, 0x02,
+0x06, 0x01, 0x11, 0x10, 0x0D, 0x05, 0x01, 0x11, 0x00, 0x02, 0x02, 0x06, 0x06, 0x61, 0x10, 0x0D,
+0x06, 0x00, 0x16, 0x60, 0x02, 0x01, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00,
+0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0x00,
+};
+
+// Frame 4: trimmed to 29x44 at (9, 4)
+const uint8_t sprite_spans_04[449] PROGMEM = {
+0x01, 0x0B, 0x02, 0x00, 0x01, 0x09, 0x06, 0x00, 0x22, 0x00, 0x01, 0x09, 0x07, 0x09, 0x39, 0x32,
+0x00, 0x01, 0x08, 0x09, 0x02, 0x39, 0x32, 0x32, 0x00, 0x01, 0x08, 0x09, 0x03, 0x22, 0x22, 0x22,
+0x00, 0x01, 0x08, 0x08, 0x02, 0x28, 0x88, 0x80, 0x01, 0x08, 0x08, 0x02, 0x88, 0x99, 0x90, 0x01,
+0x08, 0x08, 0x00, 0x89, 0x99, 0x90, 0x01, 0x09, 0x06, 0x05, 0x99, 0x90, 0x01, 0x09, 0x07, 0x00,
+0x98, 0x80, 0x00, 0x01, 0x07, 0x0B, 0x00, 0x88, 0x88, 0x85, 0x50, 0x00, 0x01, 0x06, 0x0E, 0x08,
+0x99, 0x99, 0x88, 0x88, 0x85, 0x00, 0x01, 0x05, 0x11, 0x09, 0x99, 0x89, 0x99, 0x99, 0x98, 0x85,
+0x50, 0x00, 0x01, 0x04, 0x14, 0x09, 0x98, 0x08, 0x99, 0x99, 0x89, 0x90, 0x58, 0x85, 0x00, 0x01,
+0x03, 0x18, 0x09, 0x88, 0x00, 0x08, 0x99, 0x98, 0x99, 0x05, 0x55, 0x88, 0x50, 0x00, 0x01, 0x03,
+0x19, 0x08, 0x80, 0x09, 0x80, 0x88, 0x88, 0x88, 0x00, 0x00, 0x55, 0x88, 0x55, 0x00, 0x02, 0x02,
+0x0F, 0x08, 0x85, 0x88, 0x98, 0x09, 0x98, 0x88, 0x00, 0x04, 0x07, 0x00, 0x55, 0x88, 0x00, 0x02,
+0x02, 0x0F, 0x09, 0x88, 0x88, 0x98, 0x09, 0x99, 0x89, 0x00, 0x06, 0x05, 0x00, 0x58, 0x00, 0x02,
+0x02, 0x0F, 0x08, 0x88, 0x80, 0x00, 0x08, 0x99, 0x89, 0x00, 0x08, 0x02, 0x00, 0x02, 0x03, 0x04,
+0x00, 0x00, 0x02, 0x08, 0x05, 0x89, 0x98, 0x90, 0x01, 0x09, 0x08, 0x05, 0x88, 0x88, 0x80, 0x01,
+0x09, 0x08, 0x00, 0x00, 0x04, 0x00, 0x01, 0x09, 0x09, 0x01, 0x11, 0x11, 0x11, 0x00, 0x01, 0x09,
+0x09, 0x01, 0x66, 0x61, 0x61, 0x00, 0x01, 0x08, 0x0B, 0x01, 0x66, 0x66, 0x16, 0x61, 0x00, 0x01,
+0x08, 0x0B, 0x01, 0x67, 0x66, 0x11, 0x66, 0x00, 0x01, 0x08, 0x0C, 0x06, 0x67, 0x61, 0x01, 0x66,
+0x60, 0x01, 0x08, 0x0D, 0x06, 0x76, 0x11, 0x00, 0x16, 0x66, 0x00, 0x02, 0x07, 0x07, 0x01, 0x66,
+0x61, 0x00, 0x01, 0x06, 0x01, 0x66, 0x60, 0x02, 0x07, 0x06, 0x06, 0x66, 0x10, 0x03, 0x06, 0x01,
+0x66, 0x60, 0x02, 0x07, 0x05, 0x06, 0x61, 0x00, 0x05, 0x06, 0x01, 0x66, 0x10, 0x02, 0x06, 0x05,
+0x06, 0x11, 0x00, 0x07, 0x06, 0x01, 0x11, 0x10, 0x02, 0x06, 0x05, 0x01, 0x11, 0x00, 0x08, 0x05,
+0x01, 0x11, 0x00, 0x02, 0x05, 0x05, 0x06, 0x11, 0x00, 0x09, 0x05, 0x01, 0x16, 0x00, 0x02, 0x05,
+0x05, 0x01, 0x11, 0x00, 0x09, 0x06, 0x01, 0x16, 0x10, 0x02, 0x04, 0x06, 0x06, 0x11, 0x10, 0x09,
+0x06, 0x01, 0x11, 0x60, 0x02, 0x04, 0x05, 0x01, 0x11, 0x00, 0x0B, 0x05, 0x01, 0x11, 0x00, 0x02,
+0x03, 0x06, 0x06, 0x11, 0x10, 0x0B, 0x05, 0x01, 0x11, 0x00, 0x02, 0x03, 0x05, 0x01, 0x11, 0x00,
+0x0C, 0x05, 0x01, 0x11, 0x00, 0x02, 0x02, 0x06, 0x06, 0x11, 0x10, 0x0D, 0x05, 0x01, 0x11, 0x00,
+0x02, 0x02, 0x05, 0x06, 0x66, 0x00, 0x0E, 0x06, 0x06, 0x66, 0x60, 0x02, 0x01, 0x06, 0x00, 0x00,
+0x00, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07,
+0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07, 0x00, 0x00, 0x00,
+0x00,
+};
+
+// Frame 7: trimmed to 21x44 at (12, 4)
+const uint8_t sprite_spans_07[378] PROGMEM = {
+0x01, 0x0D, 0x02, 0x00, 0x01, 0x0B, 0x06, 0x00, 0x22, 0x00, 0x01, 0x0B, 0x07, 0x09, 0x39, 0x32,
+0x00, 0x01, 0x0A, 0x09, 0x02, 0x39, 0x32, 0x32, 0x00, 0x01, 0x0A, 0x09, 0x03, 0x22, 0x22, 0x22,
+0x00, 0x01, 0x0A, 0x08, 0x02, 0x28, 0x88, 0x80, 0x01, 0x0A, 0x08, 0x02, 0x88, 0x99, 0x90, 0x01,
+0x06, 0x0C, 0x00, 0x00, 0x00, 0x89, 0x99, 0x90, 0x01, 0x04, 0x0E, 0x00, 0x99, 0x99, 0x50, 0x59,
+0x99, 0x00, 0x01, 0x03, 0x0E, 0x08, 0x99, 0x98, 0x89, 0x98, 0x85, 0x00, 0x01, 0x02, 0x0F, 0x08,
+0x99, 0x88, 0x58, 0x89, 0x98, 0x88, 0x00, 0x01, 0x01, 0x11, 0x08, 0x99, 0x85, 0x05, 0x89, 0x99,
+0x98, 0x88, 0x00, 0x01, 0x00, 0x13, 0x08, 0x98, 0x50, 0x00, 0x89, 0x99, 0x98, 0x99, 0x98, 0x00,
+0x01, 0x00, 0x14, 0x08, 0x99, 0x80, 0x08, 0x99, 0x89, 0x98, 0x98, 0x99, 0x80, 0x01, 0x01, 0x13,
+0x08, 0x99, 0x80, 0x59, 0x99, 0x88, 0x98, 0x58, 0x98, 0x00, 0x01, 0x02, 0x13, 0x08, 0x99, 0x05,
+0x89, 0x98, 0x88, 0x50, 0x58, 0x85, 0x00, 0x01, 0x03, 0x12, 0x08, 0x98, 0x08, 0x98, 0x98, 0x50,
+0x00, 0x58, 0x80, 0x02, 0x04, 0x0A, 0x08, 0x95, 0x08, 0x98, 0x50, 0x02, 0x05, 0x08, 0x88, 0x00,
+0x02, 0x05, 0x08, 0x09, 0x85, 0x08, 0x80, 0x02, 0x06, 0x08, 0x58, 0x50, 0x02, 0x05, 0x08, 0x08,
+0x99, 0x08, 0x50, 0x02, 0x05, 0x09, 0x85, 0x00, 0x01, 0x06, 0x0E, 0x00, 0x00, 0x40, 0x10, 0x00,
+0x89, 0x80, 0x01, 0x05, 0x0F, 0x01, 0x66, 0x66, 0x66, 0x11, 0x10, 0x89, 0x00, 0x01, 0x05, 0x0E,
+0x01, 0x67, 0x66, 0x11, 0x61, 0x11, 0x00, 0x01, 0x05, 0x0D, 0x01, 0x67, 0x76, 0x01, 0x66, 0x11,
+0x00, 0x01, 0x06, 0x0C, 0x06, 0x67, 0x71, 0x06, 0x11, 0x10, 0x01, 0x07, 0x0A, 0x06, 0x67, 0x61,
+0x01, 0x10, 0x01, 0x08, 0x08, 0x06, 0x77, 0x61, 0x00, 0x01, 0x08, 0x07, 0x00, 0x67, 0x66, 0x00,
+0x01, 0x07, 0x07, 0x01, 0x06, 0x66, 0x00, 0x01, 0x06, 0x08, 0x01, 0x10, 0x16, 0x60, 0x01, 0x05,
+0x09, 0x01, 0x11, 0x01, 0x16, 0x00, 0x01, 0x04, 0x0A, 0x00, 0x01, 0x10, 0x11, 0x10, 0x01, 0x04,
+0x09, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x04,
+0x09, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x05, 0x08, 0x00, 0x00, 0x11, 0x60, 0x01, 0x08, 0x05,
+0x01, 0x16, 0x00, 0x01, 0x08, 0x05, 0x01, 0x16, 0x00, 0x01, 0x08, 0x05, 0x00, 0x61, 0x00, 0x01,
+0x08, 0x05, 0x00, 0x00, 0x00, 0x01, 0x08, 0x05, 0x00, 0x00, 0x00, 0x01, 0x09, 0x05, 0x00, 0x00,
+0x00, 0x01, 0x0A, 0x04, 0x00, 0x00, 0x01, 0x0B, 0x02, 0x00,
+};
+
+// Frame 8: trimmed to 30x41 at (8, 8)
+const uint8_t sprite_spans_08[480] PROGMEM = {
+0x01, 0x05, 0x04, 0x00, 0x00, 0x01, 0x04, 0x06, 0x03, 0x22, 0x20, 0x01, 0x03, 0x07, 0x02, 0x32,
+0x88, 0x00, 0x01, 0x02, 0x09, 0x09, 0x32, 0x89, 0x98, 0x00, 0x01, 0x02, 0x0A, 0x03, 0x22, 0x89,
+0x99, 0x80, 0x01, 0x02, 0x0A, 0x02, 0x32, 0x89, 0x99, 0x00, 0x01, 0x03, 0x09, 0x02, 0x28, 0x88,
+0x05, 0x00, 0x01, 0x04, 0x0C, 0x00, 0x25, 0x85, 0x50, 0x00, 0x00, 0x01, 0x06, 0x0E, 0x05, 0x85,
+0x88, 0x89, 0x88, 0x00, 0x00, 0x01, 0x05, 0x11, 0x00, 0x88, 0x98, 0x89, 0x99, 0x99, 0x99, 0x80,
+0x00, 0x01, 0x04, 0x13, 0x08, 0x99, 0x99, 0x98, 0x89, 0x98, 0x58, 0x99, 0x98, 0x00, 0x01, 0x03,
+0x15, 0x09, 0x99, 0x88, 0x99, 0x98, 0x88, 0x80, 0x58, 0x98, 0x99, 0x00, 0x01, 0x02, 0x17, 0x09,
+0x99, 0x88, 0x89, 0x98, 0x88, 0x98, 0x00, 0x00, 0x08, 0x99, 0x00, 0x02, 0x01, 0x10, 0x08, 0x99,
+0x85, 0x08, 0x88, 0x99, 0x89, 0x80, 0x04, 0x05, 0x08, 0x99, 0x00, 0x02, 0x00, 0x12, 0x08, 0x99,
+0x85, 0x00, 0x08, 0x88, 0x99, 0x89, 0x50, 0x04, 0x05, 0x08, 0x95, 0x00, 0x03, 0x00, 0x06, 0x09,
+0x98, 0x50, 0x03, 0x09, 0x05, 0x88, 0x98, 0x88, 0x00, 0x05, 0x05, 0x08, 0x98, 0x00, 0x03, 0x00,
+0x05, 0x08, 0x98, 0x00, 0x05, 0x09, 0x05, 0x88, 0x88, 0x85, 0x00, 0x04, 0x05, 0x08, 0x98, 0x00,
+0x03, 0x00, 0x05, 0x08, 0x89, 0x00, 0x06, 0x09, 0x08, 0x85, 0x40, 0x00, 0x00, 0x04, 0x04, 0x08,
+0x50, 0x03, 0x01, 0x05, 0x08, 0x98, 0x00, 0x06, 0x09, 0x00, 0x01, 0x11, 0x11, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x02, 0x05, 0x08, 0x95, 0x00, 0x05, 0x0A, 0x01, 0x16, 0x61, 0x11, 0x10, 0x02, 0x02,
+0x06, 0x05, 0x89, 0x90, 0x04, 0x0B, 0x06, 0x66, 0x66, 0x01, 0x61, 0x00, 0x02, 0x03, 0x05, 0x09,
+0x98, 0x00, 0x04, 0x0C, 0x06, 0x76, 0x11, 0x01, 0x16, 0x60, 0x02, 0x03, 0x05, 0x08, 0x88, 0x00,
+0x04, 0x0D, 0x06, 0x76, 0x10, 0x01, 0x11, 0x66, 0x00, 0x03, 0x04, 0x03, 0x00, 0x00, 0x05, 0x06,
+0x06, 0x77, 0x10, 0x01, 0x06, 0x01, 0x11, 0x60, 0x02, 0x0C, 0x05, 0x06, 0x77, 0x00, 0x03, 0x06,
+0x01, 0x11, 0x60, 0x02, 0x0C, 0x05, 0x06, 0x77, 0x00, 0x04, 0x05, 0x01, 0x16, 0x00, 0x02, 0x0C,
+0x05, 0x06, 0x66, 0x00, 0x04, 0x05, 0x01, 0x16, 0x00, 0x02, 0x0C, 0x05, 0x07, 0x76, 0x00, 0x04,
+0x05, 0x01, 0x11, 0x00, 0x02, 0x0C, 0x05, 0x01, 0x11, 0x00, 0x04, 0x05, 0x01, 0x11, 0x00, 0x02,
+0x0B, 0x05, 0x06, 0x11, 0x00, 0x05, 0x05, 0x01, 0x11, 0x00, 0x02, 0x0B, 0x05, 0x06, 0x11, 0x00,
+0x05, 0x05, 0x01, 0x11, 0x00, 0x02, 0x0A, 0x05, 0x01, 0x11, 0x00, 0x06, 0x05, 0x01, 0x16, 0x00,
+0x02, 0x0A, 0x05, 0x01, 0x11, 0x00, 0x06, 0x05, 0x01, 0x16, 0x00, 0x02, 0x09, 0x05, 0x01, 0x11,
+0x00, 0x07, 0x05, 0x01, 0x16, 0x00, 0x02, 0x09, 0x05, 0x01, 0x11, 0x00, 0x08, 0x04, 0x01, 0x10,
+0x02, 0x09, 0x04, 0x01, 0x11, 0x09, 0x05, 0x01, 0x11, 0x00, 0x02, 0x08, 0x05, 0x01, 0x11, 0x00,
+0x09, 0x06, 0x01, 0x11, 0x10, 0x02, 0x08, 0x05, 0x06, 0x61, 0x00, 0x09, 0x07, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x07, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x07,
+0x00, 0x00, 0x00, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x06, 0x00, 0x00, 0x00,
+};
+
+// Frame 14: trimmed to 39x29 at (5, 13)
+const uint8_t sprite_spans_14[397] PROGMEM = {
+0x01, 0x03, 0x04, 0x00, 0x00, 0x01, 0x02, 0x06, 0x03, 0x22, 0x20, 0x02, 0x01, 0x07, 0x02, 0x32,
+0x88, 0x00, 0x0D, 0x03, 0x00, 0x00, 0x02, 0x00, 0x09, 0x09, 0x32, 0x89, 0x98, 0x00, 0x06, 0x0A,
+0x00, 0x00, 0x00, 0x99, 0x80, 0x02, 0x00, 0x0A, 0x03, 0x22, 0x89, 0x99, 0x80, 0x02, 0x0D, 0x00,
+0x08, 0x99, 0x99, 0x99, 0x88, 0x00, 0x02, 0x00, 0x0A, 0x02, 0x32, 0x89, 0x99, 0x00, 0x01, 0x0E,
+0x08, 0x89, 0x98, 0x88, 0x88, 0x50, 0x50, 0x02, 0x01, 0x15, 0x02, 0x28, 0x88, 0x05, 0x00, 0x88,
+0x99, 0x88, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x0F, 0x00, 0x25, 0x85, 0x50, 0x89,
+0x00, 0x50, 0x00, 0x01, 0x03, 0x0C, 0x00, 0x05, 0x58, 0x89, 0x99, 0x80, 0x01, 0x06, 0x18, 0x08,
+0x88, 0x89, 0x98, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x19, 0x08, 0x89,
+0x98, 0x89, 0x99, 0x98, 0x01, 0x16, 0x66, 0x66, 0x66, 0x66, 0x00, 0x01, 0x05, 0x1B, 0x08, 0x89,
+0x99, 0x89, 0x88, 0x88, 0x80, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x00, 0x01, 0x05, 0x1B, 0x08,
+0x88, 0x99, 0x89, 0x99, 0x98, 0x40, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x05, 0x1C,
+0x09, 0x88, 0x88, 0x99, 0x99, 0x88, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x10, 0x02, 0x05,
+0x13, 0x09, 0x98, 0x88, 0x88, 0x88, 0x88, 0x01, 0x11, 0x11, 0x00, 0x05, 0x05, 0x01, 0x11, 0x00,
+0x03, 0x05, 0x13, 0x09, 0x98, 0x00, 0x00, 0x00, 0x05, 0x01, 0x16, 0x61, 0x00, 0x05, 0x06, 0x01,
+0x11, 0x10, 0x01, 0x03, 0x00, 0x00, 0x03, 0x05, 0x06, 0x08, 0x99, 0x80, 0x05, 0x0A, 0x00, 0x16,
+0x77, 0x61, 0x00, 0x04, 0x09, 0x01, 0x11, 0x60, 0x00, 0x00, 0x03, 0x06, 0x05, 0x09, 0x98, 0x00,
+0x07, 0x09, 0x00, 0x67, 0x77, 0x61, 0x00, 0x04, 0x08, 0x01, 0x60, 0x00, 0x00, 0x03, 0x06, 0x06,
+0x08, 0x99, 0x50, 0x08, 0x08, 0x00, 0x67, 0x76, 0x10, 0x04, 0x06, 0x01, 0x00, 0x00, 0x03, 0x07,
+0x05, 0x08, 0x98, 0x00, 0x0A, 0x07, 0x06, 0x61, 0x11, 0x00, 0x04, 0x04, 0x00, 0x00, 0x03, 0x07,
+0x06, 0x08, 0x98, 0x50, 0x0A, 0x06, 0x01, 0x16, 0x60, 0x05, 0x02, 0x00, 0x02, 0x08, 0x05, 0x08,
+0x98, 0x00, 0x0B, 0x06, 0x01, 0x61, 0x10, 0x02, 0x09, 0x05, 0x08, 0x95, 0x00, 0x0B, 0x05, 0x01,
+0x11, 0x00, 0x02, 0x0A, 0x06, 0x08, 0x89, 0x00, 0x0A, 0x05, 0x01, 0x11, 0x00, 0x02, 0x0B, 0x06,
+0x08, 0x88, 0x80, 0x0A, 0x05, 0x01, 0x16, 0x00, 0x02, 0x0C, 0x04, 0x09, 0x90, 0x0C, 0x06, 0x06,
+0x60, 0x00, 0x02, 0x0C, 0x05, 0x09, 0x98, 0x00, 0x0B, 0x07, 0x01, 0x10, 0x00, 0x00, 0x02, 0x0D,
+0x03, 0x00, 0x00, 0x0D, 0x06, 0x00, 0x00, 0x00, 0x01, 0x1F, 0x04, 0x00, 0x00,
+};
+
+// Frame 15: trimmed to 39x18 at (6, 30)
+const uint8_t sprite_spans_15[278] PROGMEM = {
+0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x06, 0x00, 0x22, 0x00, 0x02, 0x02, 0x07, 0x09, 0x39, 0x32,
+0x00, 0x0A, 0x03, 0x00, 0x00, 0x02, 0x01, 0x09, 0x02, 0x39, 0x32, 0x32, 0x00, 0x03, 0x0A, 0x00,
+0x00, 0x00, 0x89, 0x90, 0x01, 0x01, 0x16, 0x03, 0x22, 0x22, 0x22, 0x00, 0x00, 0x58, 0x99, 0x98,
+0x98, 0x80, 0x01, 0x01, 0x16, 0x02, 0x28, 0x88, 0x80, 0x08, 0x89, 0x88, 0x88, 0x88, 0x85, 0x50,
+0x01, 0x01, 0x15, 0x02, 0x88, 0x99, 0x90, 0x88, 0x99, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+0x0E, 0x00, 0x89, 0x99, 0x90, 0x80, 0x05, 0x00, 0x01, 0x02, 0x0B, 0x05, 0x99, 0x80, 0x89, 0x98,
+0x00, 0x01, 0x03, 0x14, 0x08, 0x88, 0x88, 0x99, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
+0x18, 0x05, 0x88, 0x99, 0x88, 0x99, 0x98, 0x01, 0x11, 0x66, 0x66, 0x00, 0x00, 0x01, 0x02, 0x1C,
+0x08, 0x88, 0x99, 0x98, 0x98, 0x88, 0x80, 0x11, 0x11, 0x11, 0x16, 0x67, 0x60, 0x00, 0x02, 0x02,
+0x1F, 0x08, 0x88, 0x89, 0x98, 0x99, 0x98, 0x41, 0x11, 0x11, 0x06, 0x11, 0x16, 0x76, 0x66, 0x00,
+0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x26, 0x08, 0x85, 0x88, 0x88, 0x99, 0x98, 0x80, 0x11,
+0x60, 0x01, 0x00, 0x00, 0x11, 0x11, 0x66, 0x66, 0x00, 0x00, 0x00, 0x01, 0x01, 0x26, 0x08, 0x85,
+0x00, 0x58, 0x88, 0x88, 0x80, 0x16, 0x61, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x66, 0x00,
+0x00, 0x01, 0x00, 0x27, 0x08, 0x85, 0x99, 0x80, 0x00, 0x08, 0x85, 0x01, 0x66, 0x66, 0x66, 0x61,
+0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x03, 0x00, 0x09, 0x08, 0x80, 0x88, 0x98, 0x00,
+0x02, 0x11, 0x00, 0x00, 0x06, 0x66, 0x66, 0x66, 0x11, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x01, 0x11,
+0x00, 0x00, 0x03, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0x06, 0x00, 0x00, 0x00,
+};
+
+// Frame 16: trimmed to 28x35 at (6, 13)
+const uint8_t sprite_spans_16[385] PROGMEM = {
+0x01, 0x0D, 0x02, 0x00, 0x01, 0x0B, 0x06, 0x00, 0x22, 0x00, 0x01, 0x0B, 0x07, 0x09, 0x39, 0x32,
+0x00, 0x01, 0x0A, 0x09, 0x02, 0x39, 0x32, 0x32, 0x00, 0x01, 0x0A, 0x09, 0x03, 0x22, 0x22, 0x22,
+0x00, 0x01, 0x0A, 0x08, 0x02, 0x28, 0x88, 0x80, 0x01, 0x0A, 0x08, 0x02, 0x88, 0x99, 0x90, 0x01,
+0x0A, 0x09, 0x00, 0x89, 0x99, 0x00, 0x00, 0x01, 0x0B, 0x09, 0x05, 0x99, 0x09, 0x98, 0x00, 0x01,
+0x0B, 0x0B, 0x00, 0x88, 0x08, 0x89, 0x80, 0x00, 0x01, 0x0A, 0x0E, 0x09, 0x89, 0x80, 0x58, 0x98,
+0x88, 0x00, 0x01, 0x09, 0x10, 0x09, 0x89, 0x99, 0x80, 0x00, 0x58, 0x98, 0x80, 0x01, 0x09, 0x10,
+0x08, 0x59, 0x99, 0x98, 0x55, 0x00, 0x89, 0x80, 0x01, 0x09, 0x10, 0x08, 0x59, 0x98, 0x99, 0x85,
+0x55, 0x58, 0x80, 0x01, 0x09, 0x0F, 0x08, 0x59, 0x98, 0x99, 0x85, 0x00, 0x00, 0x00, 0x01, 0x09,
+0x0C, 0x08, 0x08, 0x88, 0x88, 0x98, 0x50, 0x01, 0x05, 0x0F, 0x00, 0x00, 0x58, 0x09, 0x88, 0x89,
+0x98, 0x00, 0x01, 0x04, 0x10, 0x09, 0x50, 0x58, 0x80, 0x59, 0x89, 0x99, 0x80, 0x01, 0x04, 0x10,
+0x09, 0x85, 0x08, 0x50, 0x09, 0x89, 0x98, 0x80, 0x02, 0x04, 0x07, 0x09, 0x80, 0x00, 0x00, 0x01,
+0x08, 0x09, 0x89, 0x88, 0x80, 0x02, 0x05, 0x03, 0x00, 0x00, 0x04, 0x0E, 0x08, 0x88, 0x88, 0x50,
+0x00, 0x00, 0x00, 0x01, 0x0C, 0x0F, 0x00, 0x04, 0x00, 0x01, 0x11, 0x16, 0x66, 0x00, 0x01, 0x0C,
+0x10, 0x01, 0x11, 0x16, 0x11, 0x11, 0x11, 0x16, 0x60, 0x01, 0x0C, 0x10, 0x06, 0x11, 0x16, 0x61,
+0x11, 0x11, 0x11, 0x60, 0x01, 0x0B, 0x11, 0x01, 0x66, 0x11, 0x16, 0x11, 0x11, 0x11, 0x11, 0x00,
+0x01, 0x0A, 0x12, 0x01, 0x66, 0x61, 0x11, 0x10, 0x00, 0x01, 0x11, 0x10, 0x02, 0x0A, 0x09, 0x06,
+0x76, 0x11, 0x10, 0x00, 0x04, 0x04, 0x01, 0x10, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03, 0x08, 0x06,
+0x77, 0x61, 0x10, 0x05, 0x05, 0x01, 0x11, 0x00, 0x02, 0x02, 0x0E, 0x00, 0x11, 0x00, 0x01, 0x67,
+0x61, 0x10, 0x06, 0x05, 0x01, 0x11, 0x00, 0x02, 0x01, 0x0E, 0x00, 0x11, 0x66, 0x16, 0x67, 0x76,
+0x10, 0x07, 0x05, 0x01, 0x11, 0x00, 0x02, 0x00, 0x0F, 0x00, 0x01, 0x16, 0x11, 0x67, 0x76, 0x11,
+0x00, 0x06, 0x05, 0x01, 0x11, 0x00, 0x02, 0x00, 0x0E, 0x00, 0x00, 0x11, 0x11, 0x66, 0x61, 0x10,
+0x07, 0x05, 0x01, 0x66, 0x00, 0x02, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x16, 0x10, 0x00, 0x08,
+0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x02, 0x05, 0x01, 0x11, 0x00, 0x0A, 0x07,
+0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x00, 0x04, 0x03, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x00,
+0x00,
+};
+
+// Frame 17: trimmed to 37x35 at (5, 13)
+const uint8_t sprite_spans_17[408] PROGMEM = {
+0x01, 0x0F, 0x02, 0x00, 0x01, 0x0D, 0x06, 0x00, 0x22, 0x00, 0x01, 0x0D, 0x07, 0x09, 0x39, 0x32,
+0x00, 0x01, 0x0C, 0x09, 0x02, 0x39, 0x32, 0x32, 0x00, 0x01, 0x0C, 0x09, 0x03, 0x22, 0x22, 0x22,
+0x00, 0x01, 0x0C, 0x08, 0x02, 0x28, 0x88, 0x80, 0x01, 0x0C, 0x08, 0x02, 0x88, 0x99, 0x90, 0x01,
+0x0C, 0x08, 0x00, 0x89, 0x99, 0x90, 0x01, 0x0D, 0x06, 0x05, 0x99, 0x90, 0x01, 0x0C, 0x0B, 0x00,
+0x08, 0x85, 0x50, 0x00, 0x00, 0x01, 0x0B, 0x13, 0x09, 0x89, 0x88, 0x88, 0x89, 0x98, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x0A, 0x1A, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x00,
+0x00, 0x00, 0x01, 0x0A, 0x1B, 0x09, 0x89, 0x99, 0x99, 0x99, 0x99, 0x89, 0x99, 0x89, 0x99, 0x99,
+0x99, 0x98, 0x00, 0x01, 0x0A, 0x1B, 0x09, 0x89, 0x99, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88,
+0x88, 0x88, 0x99, 0x00, 0x01, 0x0A, 0x1B, 0x09, 0x58, 0x99, 0x89, 0x99, 0x85, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x05, 0x88, 0x00, 0x02, 0x0A, 0x0C, 0x09, 0x08, 0x88, 0x88, 0x88, 0x50, 0x0B, 0x03,
+0x00, 0x00, 0x01, 0x07, 0x0E, 0x00, 0x05, 0x80, 0x89, 0x88, 0x89, 0x80, 0x01, 0x06, 0x0F, 0x09,
+0x50, 0x88, 0x50, 0x99, 0x89, 0x98, 0x00, 0x01, 0x06, 0x0F, 0x09, 0x85, 0x58, 0x50, 0x99, 0x89,
+0x98, 0x00, 0x01, 0x06, 0x0F, 0x09, 0x88, 0x00, 0x00, 0x89, 0x89, 0x88, 0x00, 0x02, 0x07, 0x03,
+0x00, 0x00, 0x03, 0x0D, 0x05, 0x88, 0x88, 0x50, 0x00, 0x00, 0x00, 0x01, 0x0D, 0x0E, 0x00, 0x00,
+0x40, 0x01, 0x11, 0x66, 0x60, 0x01, 0x0C, 0x10, 0x01, 0x11, 0x16, 0x11, 0x11, 0x11, 0x16, 0x60,
+0x01, 0x0C, 0x10, 0x06, 0x11, 0x16, 0x61, 0x11, 0x11, 0x11, 0x60, 0x01, 0x0B, 0x11, 0x01, 0x66,
+0x11, 0x16, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x0A, 0x12, 0x01, 0x66, 0x61, 0x11, 0x10, 0x00,
+0x01, 0x11, 0x10, 0x02, 0x0A, 0x09, 0x06, 0x76, 0x11, 0x10, 0x00, 0x04, 0x04, 0x01, 0x10, 0x03,
+0x03, 0x03, 0x00, 0x00, 0x03, 0x08, 0x06, 0x77, 0x61, 0x10, 0x05, 0x05, 0x01, 0x11, 0x00, 0x02,
+0x02, 0x0E, 0x00, 0x11, 0x00, 0x01, 0x67, 0x61, 0x10, 0x06, 0x05, 0x01, 0x11, 0x00, 0x02, 0x01,
+0x0E, 0x00, 0x11, 0x66, 0x16, 0x67, 0x76, 0x10, 0x07, 0x05, 0x01, 0x11, 0x00, 0x02, 0x00, 0x0F,
+0x00, 0x01, 0x16, 0x11, 0x67, 0x76, 0x11, 0x00, 0x06, 0x05, 0x01, 0x11, 0x00, 0x02, 0x00, 0x0E,
+0x00, 0x00, 0x11, 0x11, 0x66, 0x61, 0x10, 0x07, 0x05, 0x01, 0x66, 0x00, 0x02, 0x00, 0x0D, 0x00,
+0x00, 0x00, 0x11, 0x16, 0x10, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00,
+0x02, 0x05, 0x01, 0x11, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x00, 0x04,
+0x03, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x00, 0x00,
+};
+
+// Frame 18: trimmed to 32x35 at (6, 13)
+const uint8_t sprite_spans_18[399] PROGMEM = {
+0x01, 0x0F, 0x02, 0x00, 0x01, 0x0D, 0x06, 0x00, 0x22, 0x00, 0x01, 0x0D, 0x07, 0x09, 0x39, 0x32,
+0x00, 0x01, 0x0C, 0x09, 0x02, 0x39, 0x32, 0x32, 0x00, 0x01, 0x0C, 0x09, 0x03, 0x22, 0x22, 0x22,
+0x00, 0x01, 0x0C, 0x08, 0x02, 0x28, 0x88, 0x80, 0x01, 0x0C, 0x08, 0x02, 0x88, 0x99, 0x90, 0x01,
+0x0C, 0x08, 0x00, 0x89, 0x99, 0x90, 0x01, 0x0D, 0x06, 0x05, 0x99, 0x90, 0x01, 0x0D, 0x07, 0x00,
+0x99, 0x80, 0x00, 0x01, 0x0B, 0x0B, 0x00, 0x88, 0x88, 0x85, 0x50, 0x00, 0x01, 0x0A, 0x0E, 0x08,
+0x99, 0x99, 0x88, 0x88, 0x85, 0x00, 0x01, 0x09, 0x11, 0x09, 0x99, 0x89, 0x99, 0x99, 0x98, 0x85,
+0x50, 0x00, 0x01, 0x08, 0x14, 0x09, 0x98, 0x08, 0x99, 0x99, 0x89, 0x90, 0x58, 0x85, 0x00, 0x01,
+0x07, 0x18, 0x09, 0x88, 0x00, 0x08, 0x99, 0x98, 0x99, 0x05, 0x55, 0x88, 0x50, 0x00, 0x01, 0x07,
+0x19, 0x08, 0x80, 0x09, 0x80, 0x88, 0x88, 0x88, 0x00, 0x00, 0x55, 0x88, 0x55, 0x00, 0x02, 0x06,
+0x0F, 0x08, 0x85, 0x88, 0x98, 0x09, 0x98, 0x88, 0x00, 0x04, 0x07, 0x00, 0x55, 0x88, 0x00, 0x02,
+0x06, 0x0F, 0x09, 0x88, 0x88, 0x98, 0x09, 0x99, 0x89, 0x00, 0x06, 0x05, 0x00, 0x58, 0x00, 0x02,
+0x06, 0x0F, 0x08, 0x88, 0x80, 0x00, 0x08, 0x99, 0x89, 0x00, 0x08, 0x02, 0x00, 0x02, 0x07, 0x04,
+0x00, 0x00, 0x02, 0x08, 0x05, 0x89, 0x98, 0x90, 0x01, 0x0D, 0x0D, 0x05, 0x88, 0x88, 0x80, 0x00,
+0x00, 0x00, 0x01, 0x0D, 0x0E, 0x00, 0x00, 0x04, 0x01, 0x11, 0x66, 0x60, 0x01, 0x0C, 0x10, 0x01,
+0x11, 0x16, 0x11, 0x11, 0x11, 0x16, 0x60, 0x01, 0x0C, 0x10, 0x06, 0x11, 0x16, 0x61, 0x11, 0x11,
+0x11, 0x60, 0x01, 0x0B, 0x11, 0x01, 0x66, 0x11, 0x16, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x0A,
+0x12, 0x01, 0x66, 0x61, 0x11, 0x10, 0x00, 0x01, 0x11, 0x10, 0x02, 0x0A, 0x09, 0x06, 0x76, 0x11,
+0x10, 0x00, 0x04, 0x04, 0x01, 0x10, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03, 0x08, 0x06, 0x77, 0x61,
+0x10, 0x05, 0x05, 0x01, 0x11, 0x00, 0x02, 0x02, 0x0E, 0x00, 0x11, 0x00, 0x01, 0x67, 0x61, 0x10,
+0x06, 0x05, 0x01, 0x11, 0x00, 0x02, 0x01, 0x0E, 0x00, 0x11, 0x66, 0x16, 0x67, 0x76, 0x10, 0x07,
+0x05, 0x01, 0x11, 0x00, 0x02, 0x00, 0x0F, 0x00, 0x01, 0x16, 0x11, 0x67, 0x76, 0x11, 0x00, 0x06,
+0x05, 0x01, 0x11, 0x00, 0x02, 0x00, 0x0E, 0x00, 0x00, 0x11, 0x11, 0x66, 0x61, 0x10, 0x07, 0x05,
+0x01, 0x66, 0x00, 0x02, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x16, 0x10, 0x00, 0x08, 0x06, 0x00,
+0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x02, 0x05, 0x01, 0x11, 0x00, 0x0A, 0x07, 0x00, 0x00,
+0x00, 0x00, 0x03, 0x01, 0x02, 0x00, 0x04, 0x03, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x00, 0x00,
+};
+
+// Frame 20: trimmed to 34x38 at (5, 10)
+const uint8_t sprite_spans_20[404] PROGMEM = {
+0x01, 0x19, 0x03, 0x00, 0x00, 0x01, 0x17, 0x06, 0x00, 0x22, 0x20, 0x01, 0x17, 0x07, 0x09, 0x32,
+0x32, 0x00, 0x01, 0x16, 0x09, 0x02, 0x32, 0x32, 0x32, 0x00, 0x02, 0x12, 0x03, 0x00, 0x00, 0x01,
+0x09, 0x03, 0x22, 0x22, 0x22, 0x00, 0x01, 0x10, 0x0E, 0x00, 0x99, 0x80, 0x22, 0x22, 0x28, 0x80,
+0x01, 0x0F, 0x0F, 0x09, 0x98, 0x99, 0x85, 0x32, 0x28, 0x99, 0x00, 0x01, 0x0E, 0x10, 0x09, 0x88,
+0x58, 0x99, 0x85, 0x23, 0x89, 0x90, 0x01, 0x0D, 0x10, 0x08, 0x88, 0x08, 0x89, 0x89, 0x98, 0x89,
+0x90, 0x01, 0x0C, 0x10, 0x08, 0x85, 0x50, 0x89, 0x98, 0x99, 0x90, 0x00, 0x02, 0x0C, 0x0F, 0x08,
+0x88, 0x00, 0x89, 0x89, 0x98, 0x98, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02, 0x0D, 0x0E, 0x08, 0x85,
+0x08, 0x98, 0x98, 0x89, 0x90, 0x02, 0x05, 0x08, 0x99, 0x00, 0x02, 0x0E, 0x0E, 0x05, 0x05, 0x99,
+0x99, 0x85, 0x99, 0x80, 0x01, 0x05, 0x05, 0x89, 0x00, 0x01, 0x0F, 0x13, 0x00, 0x89, 0x99, 0x98,
+0x58, 0x99, 0x00, 0x58, 0x89, 0x00, 0x01, 0x10, 0x11, 0x08, 0x98, 0x98, 0x80, 0x59, 0x95, 0x88,
+0x88, 0x00, 0x01, 0x10, 0x10, 0x08, 0x88, 0x98, 0x80, 0x08, 0x99, 0x88, 0x50, 0x02, 0x0F, 0x09,
+0x01, 0x08, 0x88, 0x85, 0x00, 0x01, 0x06, 0x08, 0x99, 0x50, 0x02, 0x0E, 0x09, 0x01, 0x61, 0x00,
+0x55, 0x00, 0x03, 0x04, 0x05, 0x80, 0x02, 0x0E, 0x09, 0x06, 0x76, 0x11, 0x00, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x0D, 0x0B, 0x06, 0x77, 0x76, 0x11, 0x10, 0x00, 0x01, 0x0C, 0x0D, 0x01, 0x77, 0x66,
+0x61, 0x16, 0x61, 0x00, 0x01, 0x0B, 0x0F, 0x01, 0x67, 0x76, 0x10, 0x11, 0x16, 0x66, 0x00, 0x01,
+0x0B, 0x10, 0x07, 0x77, 0x61, 0x00, 0x01, 0x11, 0x16, 0x60, 0x02, 0x0A, 0x07, 0x06, 0x76, 0x61,
+0x00, 0x02, 0x08, 0x00, 0x00, 0x11, 0x60, 0x02, 0x09, 0x07, 0x06, 0x66, 0x11, 0x00, 0x04, 0x07,
+0x01, 0x10, 0x11, 0x00, 0x02, 0x07, 0x08, 0x00, 0x61, 0x16, 0x10, 0x04, 0x08, 0x01, 0x11, 0x11,
+0x10, 0x02, 0x06, 0x08, 0x06, 0x61, 0x11, 0x10, 0x04, 0x08, 0x06, 0x11, 0x11, 0x00, 0x02, 0x05,
+0x08, 0x06, 0x61, 0x11, 0x00, 0x04, 0x07, 0x06, 0x11, 0x10, 0x00, 0x02, 0x04, 0x07, 0x00, 0x61,
+0x11, 0x00, 0x05, 0x06, 0x00, 0x11, 0x10, 0x02, 0x03, 0x07, 0x06, 0x61, 0x11, 0x00, 0x06, 0x05,
+0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x06, 0x11, 0x11, 0x00, 0x07, 0x04, 0x00, 0x00, 0x02, 0x02,
+0x06, 0x06, 0x11, 0x10, 0x08, 0x04, 0x00, 0x00, 0x02, 0x01, 0x06, 0x00, 0x16, 0x60, 0x09, 0x04,
+0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x00, 0x10, 0x0A, 0x03, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00,
+0x00, 0x00, 0x0C, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01,
+0x01, 0x04, 0x00, 0x00,
+};
+
+// Frame 21: trimmed to 36x37 at (2, 11)
+const uint8_t sprite_spans_21[413] PROGMEM = {
+0x01, 0x1C, 0x03, 0x00, 0x00, 0x01, 0x1A, 0x06, 0x00, 0x22, 0x20, 0x01, 0x1A, 0x07, 0x09, 0x32,
+0x32, 0x00, 0x01, 0x19, 0x09, 0x02, 0x32, 0x32, 0x32, 0x00, 0x02, 0x11, 0x05, 0x00, 0x00, 0x00,
+0x03, 0x09, 0x03, 0x22, 0x22, 0x22, 0x00, 0x01, 0x10, 0x11, 0x09, 0x98, 0x99, 0x00, 0x00, 0x22,
+0x22, 0x88, 0x00, 0x01, 0x0F, 0x12, 0x08, 0x88, 0x88, 0x89, 0x95, 0x02, 0x22, 0x89, 0x90, 0x01,
+0x0F, 0x12, 0x08, 0x88, 0x55, 0x08, 0x98, 0x80, 0x23, 0x89, 0x90, 0x02, 0x0E, 0x12, 0x08, 0x85,
+0x00, 0x50, 0x99, 0x99, 0x85, 0x89, 0x90, 0x01, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x08, 0x80, 0x02,
+0x0B, 0x05, 0x98, 0x99, 0x98, 0x80, 0x00, 0x01, 0x04, 0x08, 0x80, 0x03, 0x0D, 0x04, 0x05, 0x80,
+0x03, 0x0A, 0x09, 0x89, 0x88, 0x99, 0x90, 0x02, 0x04, 0x08, 0x90, 0x03, 0x0D, 0x04, 0x08, 0x50,
+0x03, 0x0B, 0x09, 0x89, 0x95, 0x89, 0x98, 0x00, 0x01, 0x04, 0x08, 0x90, 0x02, 0x0D, 0x04, 0x08,
+0x80, 0x02, 0x11, 0x08, 0x98, 0x99, 0x80, 0x88, 0x98, 0x00, 0x58, 0x00, 0x02, 0x0D, 0x04, 0x08,
+0x80, 0x02, 0x10, 0x08, 0x89, 0x98, 0x85, 0x08, 0x99, 0x88, 0x80, 0x02, 0x0E, 0x02, 0x00, 0x03,
+0x10, 0x08, 0x99, 0x88, 0x85, 0x00, 0x88, 0x98, 0x50, 0x02, 0x12, 0x09, 0x00, 0x58, 0x88, 0x85,
+0x00, 0x02, 0x06, 0x08, 0x89, 0x00, 0x02, 0x11, 0x09, 0x01, 0x10, 0x58, 0x85, 0x00, 0x04, 0x04,
+0x05, 0x80, 0x02, 0x10, 0x09, 0x01, 0x16, 0x10, 0x00, 0x00, 0x06, 0x02, 0x00, 0x01, 0x10, 0x09,
+0x01, 0x67, 0x66, 0x11, 0x00, 0x02, 0x03, 0x04, 0x00, 0x00, 0x08, 0x0B, 0x01, 0x67, 0x76, 0x11,
+0x16, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0x10, 0x00, 0x06, 0x0C, 0x06, 0x77, 0x61, 0x10, 0x16,
+0x60, 0x02, 0x02, 0x0A, 0x00, 0x00, 0x16, 0x60, 0x00, 0x02, 0x0E, 0x06, 0x67, 0x61, 0x00, 0x11,
+0x16, 0x60, 0x02, 0x01, 0x13, 0x00, 0x00, 0x11, 0x16, 0x66, 0x60, 0x06, 0x67, 0x66, 0x00, 0x01,
+0x08, 0x01, 0x11, 0x16, 0x60, 0x02, 0x01, 0x12, 0x00, 0x00, 0x01, 0x11, 0x11, 0x16, 0x66, 0x67,
+0x60, 0x03, 0x07, 0x01, 0x16, 0x66, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x02, 0x0C, 0x00, 0x00,
+0x11, 0x11, 0x66, 0x10, 0x05, 0x07, 0x01, 0x16, 0x66, 0x00, 0x03, 0x01, 0x02, 0x00, 0x07, 0x07,
+0x00, 0x01, 0x11, 0x00, 0x07, 0x06, 0x01, 0x16, 0x10, 0x02, 0x0D, 0x03, 0x00, 0x00, 0x09, 0x05,
+0x01, 0x11, 0x00, 0x01, 0x1A, 0x05, 0x01, 0x11, 0x00, 0x01, 0x1A, 0x05, 0x01, 0x11, 0x00, 0x01,
+0x1B, 0x04, 0x01, 0x10, 0x01, 0x1B, 0x04, 0x01, 0x10, 0x01, 0x1B, 0x04, 0x01, 0x10, 0x01, 0x1B,
+0x04, 0x01, 0x10, 0x01, 0x1B, 0x05, 0x01, 0x66, 0x00, 0x01, 0x1B, 0x06, 0x06, 0x61, 0x00, 0x01,
+0x1C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Frame 22: trimmed to 32x38 at (8, 10)
+const uint8_t sprite_spans_22[345] PROGMEM = {
+0x01, 0x16, 0x03, 0x00, 0x00, 0x01, 0x14, 0x06, 0x00, 0x22, 0x20, 0x01, 0x14, 0x07, 0x09, 0x32,
+0x32, 0x00, 0x01, 0x13, 0x09, 0x02, 0x32, 0x32, 0x32, 0x00, 0x01, 0x13, 0x09, 0x03, 0x22, 0x22,
+0x22, 0x00, 0x01, 0x13, 0x08, 0x02, 0x22, 0x28, 0x80, 0x01, 0x10, 0x0B, 0x00, 0x00, 0x22, 0x28,
+0x99, 0x00, 0x01, 0x0F, 0x0C, 0x08, 0x99, 0x95, 0x23, 0x89, 0x90, 0x01, 0x0E, 0x0C, 0x09, 0x88,
+0x99, 0x98, 0x89, 0x90, 0x01, 0x0D, 0x0C, 0x09, 0x80, 0x99, 0x89, 0x90, 0x00, 0x01, 0x0C, 0x0C,
+0x09, 0x88, 0x09, 0x88, 0x99, 0x90, 0x02, 0x0C, 0x0C, 0x08, 0x85, 0x09, 0x80, 0x89, 0x80, 0x04,
+0x02, 0x00, 0x02, 0x0C, 0x0C, 0x08, 0x80, 0x99, 0x80, 0x99, 0x90, 0x03, 0x04, 0x05, 0x90, 0x01,
+0x0C, 0x14, 0x08, 0x80, 0x99, 0x80, 0x89, 0x98, 0x00, 0x05, 0x88, 0x90, 0x01, 0x0D, 0x13, 0x05,
+0x09, 0x98, 0x80, 0x99, 0x95, 0x88, 0x98, 0x89, 0x00, 0x01, 0x0E, 0x11, 0x00, 0x98, 0x88, 0x50,
+0x89, 0x88, 0x99, 0x50, 0x00, 0x01, 0x0F, 0x0E, 0x05, 0x88, 0x85, 0x00, 0x88, 0x50, 0x00, 0x02,
+0x0F, 0x07, 0x00, 0x58, 0x55, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x0E, 0x08, 0x01, 0x10, 0x00,
+0x00, 0x01, 0x0D, 0x09, 0x01, 0x66, 0x11, 0x11, 0x00, 0x01, 0x0D, 0x09, 0x06, 0x76, 0x61, 0x11,
+0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x07, 0x09, 0x07, 0x76, 0x11, 0x11, 0x00, 0x02, 0x02, 0x06,
+0x00, 0x01, 0x00, 0x04, 0x09, 0x01, 0x77, 0x60, 0x11, 0x00, 0x01, 0x01, 0x14, 0x00, 0x00, 0x16,
+0x60, 0x00, 0x00, 0x17, 0x76, 0x01, 0x10, 0x01, 0x01, 0x14, 0x00, 0x01, 0x16, 0x16, 0x66, 0x60,
+0x17, 0x76, 0x01, 0x10, 0x01, 0x00, 0x15, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x16, 0x76, 0x01,
+0x11, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x11, 0x16, 0x66, 0x60, 0x11,
+0x60, 0x02, 0x01, 0x02, 0x00, 0x06, 0x0B, 0x00, 0x01, 0x66, 0x10, 0x16, 0x00, 0x01, 0x0C, 0x07,
+0x01, 0x10, 0x11, 0x00, 0x01, 0x0D, 0x06, 0x00, 0x11, 0x10, 0x01, 0x0E, 0x04, 0x01, 0x10, 0x01,
+0x0E, 0x04, 0x01, 0x10, 0x01, 0x0D, 0x05, 0x01, 0x11, 0x00, 0x01, 0x0D, 0x05, 0x01, 0x11, 0x00,
+0x01, 0x0D, 0x04, 0x06, 0x60, 0x01, 0x0D, 0x05, 0x00, 0x00, 0x00, 0x01, 0x0D, 0x07, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x0D, 0x07, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Frame 23: trimmed to 23x38 at (12, 10)
+const uint8_t sprite_spans_23[298] PROGMEM = {
+0x01, 0x11, 0x03, 0x00, 0x00, 0x01, 0x0F, 0x06, 0x00, 0x22, 0x20, 0x01, 0x0F, 0x07, 0x09, 0x32,
+0x32, 0x00, 0x01, 0x0E, 0x09, 0x02, 0x32, 0x32, 0x32, 0x00, 0x01, 0x0E, 0x09, 0x03, 0x22, 0x22,
+0x22, 0x00, 0x01, 0x0E, 0x08, 0x02, 0x22, 0x28, 0x80, 0x01, 0x0E, 0x08, 0x02, 0x22, 0x89, 0x90,
+0x01, 0x0C, 0x0A, 0x00, 0x05, 0x23, 0x89, 0x90, 0x01, 0x0B, 0x0A, 0x08, 0x99, 0x88, 0x89, 0x90,
+0x01, 0x0A, 0x0A, 0x08, 0x99, 0x99, 0x85, 0x00, 0x01, 0x0A, 0x08, 0x08, 0x99, 0x85, 0x50, 0x01,
+0x0A, 0x08, 0x09, 0x98, 0x05, 0x80, 0x01, 0x09, 0x09, 0x08, 0x99, 0x80, 0x58, 0x00, 0x01, 0x09,
+0x0C, 0x08, 0x88, 0x05, 0x88, 0x00, 0x00, 0x01, 0x09, 0x0D, 0x08, 0x88, 0x05, 0x80, 0x50, 0x85,
+0x00, 0x01, 0x09, 0x0D, 0x00, 0x88, 0x80, 0x00, 0x00, 0x88, 0x00, 0x01, 0x08, 0x0E, 0x00, 0x50,
+0x88, 0x88, 0x95, 0x05, 0x80, 0x01, 0x07, 0x0E, 0x01, 0x10, 0x00, 0x58, 0x99, 0x80, 0x00, 0x01,
+0x06, 0x0D, 0x01, 0x66, 0x61, 0x00, 0x08, 0x95, 0x00, 0x02, 0x06, 0x08, 0x01, 0x67, 0x76, 0x10,
+0x01, 0x03, 0x00, 0x00, 0x01, 0x06, 0x08, 0x01, 0x16, 0x77, 0x60, 0x01, 0x03, 0x0B, 0x00, 0x01,
+0x11, 0x67, 0x76, 0x00, 0x01, 0x02, 0x0C, 0x00, 0x01, 0x00, 0x01, 0x77, 0x60, 0x01, 0x02, 0x0D,
+0x00, 0x06, 0x66, 0x10, 0x67, 0x76, 0x00, 0x01, 0x01, 0x0E, 0x00, 0x01, 0x11, 0x66, 0x11, 0x67,
+0x60, 0x01, 0x01, 0x0E, 0x00, 0x01, 0x11, 0x11, 0x11, 0x67, 0x60, 0x01, 0x01, 0x0E, 0x00, 0x00,
+0x00, 0x01, 0x11, 0x16, 0x00, 0x01, 0x02, 0x0C, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x01, 0x03,
+0x05, 0x01, 0x11, 0x00, 0x01, 0x03, 0x04, 0x01, 0x10, 0x01, 0x02, 0x05, 0x01, 0x11, 0x00, 0x01,
+0x02, 0x05, 0x01, 0x11, 0x00, 0x01, 0x01, 0x05, 0x01, 0x11, 0x00, 0x01, 0x01, 0x05, 0x01, 0x11,
+0x00, 0x01, 0x00, 0x05, 0x01, 0x66, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x06, 0x00, 0x00, 0x00,
+};
+
+// Frame 24: trimmed to 33x38 at (5, 10)
+const uint8_t sprite_spans_24[381] PROGMEM = {
+0x01, 0x18, 0x03, 0x00, 0x00, 0x01, 0x16, 0x06, 0x00, 0x22, 0x20, 0x01, 0x16, 0x07, 0x09, 0x32,
+0x32, 0x00, 0x01, 0x15, 0x09, 0x02, 0x32, 0x32, 0x32, 0x00, 0x01, 0x15, 0x09, 0x03, 0x22, 0x22,
+0x22, 0x00, 0x01, 0x15, 0x08, 0x02, 0x22, 0x28, 0x80, 0x01, 0x12, 0x0B, 0x00, 0x00, 0x22, 0x28,
+0x99, 0x00, 0x01, 0x10, 0x0D, 0x00, 0x89, 0x95, 0x02, 0x38, 0x99, 0x00, 0x01, 0x0F, 0x0D, 0x08,
+0x89, 0x98, 0x88, 0x58, 0x99, 0x00, 0x01, 0x0E, 0x0D, 0x09, 0x98, 0x88, 0x88, 0x88, 0x80, 0x00,
+0x01, 0x0D, 0x0E, 0x05, 0x98, 0x80, 0x58, 0x88, 0x88, 0x50, 0x02, 0x0D, 0x0F, 0x09, 0x88, 0x05,
+0x88, 0x98, 0x88, 0x85, 0x00, 0x02, 0x02, 0x00, 0x02, 0x0D, 0x0F, 0x08, 0x95, 0x08, 0x89, 0x88,
+0x85, 0x88, 0x00, 0x01, 0x04, 0x09, 0x90, 0x01, 0x0D, 0x14, 0x08, 0x88, 0x05, 0x89, 0x88, 0x55,
+0x85, 0x00, 0x58, 0x50, 0x01, 0x0E, 0x13, 0x08, 0x88, 0x08, 0x88, 0x50, 0x88, 0x05, 0x58, 0x85,
+0x00, 0x01, 0x0F, 0x11, 0x08, 0x88, 0x00, 0x50, 0x05, 0x88, 0x88, 0x85, 0x00, 0x01, 0x0F, 0x10,
+0x00, 0x88, 0x88, 0x00, 0x05, 0x88, 0x55, 0x00, 0x02, 0x0E, 0x09, 0x01, 0x10, 0x99, 0x85, 0x00,
+0x01, 0x05, 0x05, 0x50, 0x00, 0x02, 0x0E, 0x09, 0x01, 0x61, 0x09, 0x95, 0x00, 0x02, 0x02, 0x00,
+0x01, 0x0D, 0x0A, 0x01, 0x66, 0x66, 0x00, 0x00, 0x01, 0x0C, 0x0C, 0x01, 0x11, 0x67, 0x76, 0x66,
+0x00, 0x01, 0x0B, 0x0E, 0x01, 0x61, 0x10, 0x16, 0x77, 0x76, 0x60, 0x01, 0x0B, 0x0F, 0x06, 0x66,
+0x11, 0x00, 0x16, 0x67, 0x76, 0x00, 0x02, 0x0A, 0x07, 0x01, 0x66, 0x11, 0x00, 0x02, 0x08, 0x00,
+0x16, 0x77, 0x60, 0x02, 0x09, 0x07, 0x01, 0x66, 0x11, 0x00, 0x05, 0x06, 0x06, 0x66, 0x10, 0x02,
+0x08, 0x07, 0x06, 0x11, 0x11, 0x00, 0x04, 0x08, 0x00, 0x66, 0x11, 0x10, 0x02, 0x07, 0x07, 0x06,
+0x11, 0x11, 0x00, 0x02, 0x0A, 0x00, 0x06, 0x61, 0x11, 0x00, 0x02, 0x06, 0x07, 0x01, 0x11, 0x10,
+0x00, 0x02, 0x09, 0x00, 0x16, 0x11, 0x10, 0x00, 0x02, 0x04, 0x07, 0x00, 0x11, 0x11, 0x00, 0x04,
+0x07, 0x00, 0x01, 0x10, 0x00, 0x02, 0x03, 0x07, 0x01, 0x11, 0x11, 0x00, 0x05, 0x05, 0x00, 0x01,
+0x00, 0x02, 0x02, 0x07, 0x01, 0x11, 0x10, 0x00, 0x06, 0x04, 0x00, 0x00, 0x02, 0x01, 0x06, 0x06,
+0x11, 0x10, 0x08, 0x04, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x16, 0x10, 0x0A, 0x03, 0x00, 0x00,
+0x02, 0x00, 0x05, 0x00, 0x01, 0x00, 0x0B, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00,
+};
+
+// Frame 25: trimmed to 37x37 at (2, 11)
+const uint8_t sprite_spans_25[405] PROGMEM = {
+0x01, 0x1C, 0x03, 0x00, 0x00, 0x01, 0x1A, 0x06, 0x00, 0x22, 0x20, 0x01, 0x1A, 0x07, 0x09, 0x32,
+0x32, 0x00, 0x01, 0x19, 0x09, 0x02, 0x32, 0x32, 0x32, 0x00, 0x02, 0x13, 0x05, 0x00, 0x00, 0x00,
+0x01, 0x09, 0x03, 0x22, 0x22, 0x22, 0x00, 0x01, 0x10, 0x11, 0x00, 0x08, 0x99, 0x98, 0x00, 0x22,
+0x22, 0x88, 0x00, 0x01, 0x0F, 0x12, 0x08, 0x99, 0x88, 0x89, 0x98, 0x02, 0x22, 0x89, 0x90, 0x01,
+0x0E, 0x13, 0x09, 0x99, 0x99, 0x88, 0x88, 0x85, 0x02, 0x38, 0x99, 0x00, 0x01, 0x0E, 0x12, 0x08,
+0x99, 0x80, 0x00, 0x58, 0x88, 0x55, 0x89, 0x90, 0x03, 0x0F, 0x04, 0x08, 0x90, 0x01, 0x0B, 0x05,
+0x88, 0x88, 0x88, 0x80, 0x00, 0x02, 0x03, 0x00, 0x00, 0x02, 0x0F, 0x0F, 0x08, 0x98, 0x05, 0x88,
+0x89, 0x89, 0x88, 0x00, 0x02, 0x05, 0x05, 0x88, 0x00, 0x02, 0x10, 0x0F, 0x08, 0x85, 0x00, 0x89,
+0x98, 0x99, 0x85, 0x00, 0x01, 0x05, 0x08, 0x99, 0x00, 0x01, 0x11, 0x14, 0x05, 0x99, 0x80, 0x98,
+0x89, 0x80, 0x50, 0x00, 0x58, 0x90, 0x01, 0x11, 0x13, 0x08, 0x98, 0x80, 0x88, 0x98, 0x00, 0x85,
+0x05, 0x58, 0x00, 0x01, 0x12, 0x12, 0x05, 0x50, 0x58, 0x88, 0x00, 0x58, 0x85, 0x88, 0x50, 0x02,
+0x11, 0x09, 0x00, 0x00, 0x58, 0x88, 0x00, 0x02, 0x07, 0x05, 0x88, 0x85, 0x00, 0x02, 0x10, 0x09,
+0x01, 0x10, 0x05, 0x55, 0x00, 0x04, 0x05, 0x05, 0x55, 0x00, 0x02, 0x0F, 0x09, 0x01, 0x11, 0x11,
+0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x01, 0x0E, 0x0A, 0x01, 0x61, 0x11, 0x61, 0x10, 0x02, 0x03,
+0x03, 0x00, 0x00, 0x08, 0x0B, 0x06, 0x60, 0x16, 0x66, 0x61, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00,
+0x00, 0x00, 0x04, 0x0D, 0x01, 0x66, 0x10, 0x16, 0x77, 0x66, 0x00, 0x02, 0x01, 0x0A, 0x00, 0x00,
+0x06, 0x11, 0x00, 0x02, 0x0E, 0x06, 0x66, 0x10, 0x01, 0x67, 0x76, 0x60, 0x02, 0x00, 0x12, 0x00,
+0x00, 0x06, 0x11, 0x66, 0x10, 0x06, 0x66, 0x10, 0x02, 0x08, 0x00, 0x67, 0x76, 0x60, 0x02, 0x00,
+0x11, 0x00, 0x00, 0x11, 0x11, 0x16, 0x61, 0x11, 0x61, 0x00, 0x04, 0x07, 0x01, 0x67, 0x76, 0x00,
+0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x06, 0x07, 0x01, 0x67, 0x61,
+0x00, 0x03, 0x01, 0x02, 0x00, 0x05, 0x07, 0x00, 0x01, 0x10, 0x00, 0x08, 0x06, 0x01, 0x66, 0x10,
+0x02, 0x0B, 0x02, 0x00, 0x0B, 0x05, 0x00, 0x11, 0x00, 0x01, 0x19, 0x04, 0x01, 0x60, 0x01, 0x19,
+0x04, 0x01, 0x60, 0x01, 0x19, 0x04, 0x01, 0x60, 0x01, 0x19, 0x05, 0x01, 0x61, 0x00, 0x01, 0x19,
+0x05, 0x01, 0x16, 0x00, 0x01, 0x1A, 0x05, 0x01, 0x61, 0x00, 0x01, 0x1A, 0x06, 0x01, 0x16, 0x10,
+0x01, 0x1A, 0x07, 0x01, 0x16, 0x10, 0x00, 0x01, 0x1A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1B,
+0x07, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Frame 26: trimmed to 27x38 at (9, 10)
+const uint8_t sprite_spans_26[323] PROGMEM = {
+0x01, 0x15, 0x03, 0x00, 0x00, 0x01, 0x13, 0x06, 0x00, 0x22, 0x20, 0x01, 0x13, 0x07, 0x09, 0x32,
+0x32, 0x00, 0x01, 0x12, 0x09, 0x02, 0x32, 0x32, 0x32, 0x00, 0x01, 0x12, 0x09, 0x03, 0x22, 0x22,
+0x22, 0x00, 0x01, 0x12, 0x08, 0x02, 0x22, 0x28, 0x80, 0x01, 0x12, 0x08, 0x02, 0x22, 0x89, 0x90,
+0x01, 0x11, 0x09, 0x00, 0x02, 0x38, 0x99, 0x00, 0x01, 0x10, 0x09, 0x08, 0x98, 0x58, 0x99, 0x00,
+0x01, 0x0F, 0x09, 0x08, 0x99, 0x98, 0x50, 0x00, 0x01, 0x0E, 0x08, 0x08, 0x99, 0x85, 0x80, 0x01,
+0x0D, 0x09, 0x08, 0x99, 0x88, 0x05, 0x00, 0x01, 0x0D, 0x09, 0x08, 0x99, 0x80, 0x58, 0x00, 0x02,
+0x0C, 0x0A, 0x09, 0x89, 0x80, 0x58, 0x50, 0x01, 0x02, 0x00, 0x01, 0x0C, 0x0E, 0x09, 0x88, 0x00,
+0x85, 0x05, 0x08, 0x50, 0x01, 0x0C, 0x0E, 0x08, 0x88, 0x85, 0x00, 0x00, 0x88, 0x80, 0x01, 0x0B,
+0x0F, 0x00, 0x00, 0x88, 0x88, 0x58, 0x50, 0x55, 0x00, 0x01, 0x0B, 0x0E, 0x01, 0x00, 0x00, 0x58,
+0x99, 0x90, 0x00, 0x01, 0x0B, 0x0B, 0x01, 0x11, 0x00, 0x00, 0x89, 0x00, 0x02, 0x0B, 0x07, 0x01,
+0x66, 0x11, 0x00, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x00, 0x06, 0x07, 0x00, 0x66, 0x66, 0x00,
+0x02, 0x02, 0x05, 0x00, 0x00, 0x00, 0x03, 0x08, 0x01, 0x06, 0x67, 0x60, 0x02, 0x02, 0x06, 0x00,
+0x06, 0x10, 0x02, 0x08, 0x01, 0x06, 0x77, 0x70, 0x01, 0x01, 0x11, 0x00, 0x01, 0x61, 0x10, 0x00,
+0x10, 0x66, 0x77, 0x00, 0x01, 0x01, 0x11, 0x00, 0x01, 0x11, 0x66, 0x10, 0x10, 0x16, 0x76, 0x00,
+0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x66, 0x11, 0x01, 0x66, 0x60, 0x02, 0x00, 0x04, 0x00,
+0x00, 0x02, 0x0B, 0x00, 0x11, 0x11, 0x01, 0x16, 0x00, 0x02, 0x01, 0x02, 0x00, 0x05, 0x09, 0x00,
+0x11, 0x01, 0x11, 0x00, 0x01, 0x0A, 0x06, 0x00, 0x11, 0x10, 0x01, 0x0B, 0x05, 0x06, 0x11, 0x00,
+0x01, 0x0B, 0x05, 0x06, 0x11, 0x00, 0x01, 0x0A, 0x06, 0x01, 0x61, 0x10, 0x01, 0x0A, 0x05, 0x01,
+0x61, 0x00, 0x01, 0x0A, 0x05, 0x06, 0x61, 0x00, 0x01, 0x09, 0x06, 0x01, 0x61, 0x10, 0x01, 0x09,
+0x07, 0x01, 0x11, 0x10, 0x00, 0x01, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x08, 0x00,
+0x00, 0x00, 0x00,
+};
+
+// Frame 27: trimmed to 24x38 at (11, 10)
+const uint8_t sprite_spans_27[326] PROGMEM = {
+0x01, 0x12, 0x03, 0x00, 0x00, 0x01, 0x10, 0x06, 0x00, 0x22, 0x20, 0x01, 0x10, 0x07, 0x09, 0x32,
+0x32, 0x00, 0x01, 0x0F, 0x09, 0x02, 0x32, 0x32, 0x32, 0x00, 0x01, 0x0F, 0x09, 0x03, 0x22, 0x22,
+0x22, 0x00, 0x01, 0x0F, 0x08, 0x02, 0x22, 0x28, 0x80, 0x01, 0x0B, 0x0C, 0x00, 0x00, 0x52, 0x22,
+0x89, 0x90, 0x01, 0x09, 0x0E, 0x00, 0x88, 0x89, 0x85, 0x23, 0x89, 0x90, 0x01, 0x08, 0x0E, 0x09,
+0x88, 0x59, 0x98, 0x85, 0x89, 0x90, 0x01, 0x07, 0x0E, 0x09, 0x88, 0x09, 0x88, 0x88, 0x05, 0x00,
+0x02, 0x06, 0x0D, 0x08, 0x88, 0x09, 0x88, 0x89, 0x98, 0x00, 0x02, 0x02, 0x00, 0x02, 0x06, 0x0D,
+0x08, 0x85, 0x09, 0x88, 0x09, 0x85, 0x00, 0x01, 0x04, 0x08, 0x90, 0x01, 0x07, 0x11, 0x05, 0x50,
+0x88, 0x80, 0x99, 0x80, 0x08, 0x89, 0x00, 0x01, 0x08, 0x10, 0x00, 0x98, 0x88, 0x08, 0x99, 0x88,
+0x88, 0x80, 0x01, 0x09, 0x0E, 0x09, 0x88, 0x80, 0x88, 0x88, 0x85, 0x00, 0x01, 0x09, 0x0C, 0x08,
+0x88, 0x85, 0x05, 0x88, 0x00, 0x01, 0x08, 0x0B, 0x01, 0x08, 0x85, 0x50, 0x00, 0x00, 0x01, 0x07,
+0x08, 0x01, 0x11, 0x00, 0x50, 0x01, 0x07, 0x08, 0x01, 0x16, 0x11, 0x00, 0x01, 0x07, 0x08, 0x01,
+0x66, 0x61, 0x10, 0x02, 0x02, 0x02, 0x00, 0x03, 0x08, 0x01, 0x67, 0x60, 0x10, 0x01, 0x01, 0x0E,
+0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x10, 0x01, 0x01, 0x0F, 0x00, 0x06, 0x61, 0x06, 0x76, 0x01,
+0x16, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x11, 0x06, 0x76, 0x10, 0x11, 0x60, 0x01, 0x00, 0x10,
+0x00, 0x00, 0x11, 0x06, 0x76, 0x10, 0x11, 0x10, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x66,
+0x01, 0x11, 0x10, 0x02, 0x00, 0x03, 0x00, 0x00, 0x02, 0x0A, 0x06, 0x61, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x02, 0x00, 0x02, 0x06, 0x06, 0x61, 0x10, 0x01, 0x04, 0x06, 0x06, 0x11, 0x10, 0x01, 0x03,
+0x06, 0x06, 0x11, 0x10, 0x01, 0x03, 0x05, 0x01, 0x11, 0x00, 0x01, 0x03, 0x05, 0x01, 0x11, 0x00,
+0x01, 0x02, 0x05, 0x01, 0x11, 0x00, 0x01, 0x02, 0x05, 0x01, 0x66, 0x00, 0x01, 0x01, 0x05, 0x01,
+0x11, 0x00, 0x01, 0x01, 0x06, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x01, 0x07, 0x00, 0x00, 0x00, 0x00,
+};
+
+// { trimX, trimY, trimWidth, trimHeight, spans }
+const SpriteFrame fighter_frames[] = {
+    { 12,  3, 22, 45, sprite_spans_00 },
+    {  6, 18, 28, 30, sprite_spans_01 },
+    {  8,  4, 29, 44, sprite_spans_02 },
+    {  8,  4, 33, 44, sprite_spans_03 },
+    {  9,  4, 29, 44, sprite_spans_04 },
+    {  0,  0,  0,  0, sprite_spans_empty },
+    {  0,  0,  0,  0, sprite_spans_empty },
+    { 12,  4, 21, 44, sprite_spans_07 },
+    {  8,  8, 30, 41, sprite_spans_08 },
+    {  0,  0,  0,  0, sprite_spans_empty },
+    {  0,  0,  0,  0, sprite_spans_empty },
+    {  0,  0,  0,  0, sprite_spans_empty },
+    {  0,  0,  0,  0, sprite_spans_empty },
+    {  0,  0,  0,  0, sprite_spans_empty },
+    {  5, 13, 39, 29, sprite_spans_14 },
+    {  6, 30, 39, 18, sprite_spans_15 },
+    {  6, 13, 28, 35, sprite_spans_16 },
+    {  5, 13, 37, 35, sprite_spans_17 },
+    {  6, 13, 32, 35, sprite_spans_18 },
+    {  0,  0,  0,  0, sprite_spans_empty },
+    {  5, 10, 34, 38, sprite_spans_20 },
+    {  2, 11, 36, 37, sprite_spans_21 },
+    {  8, 10, 32, 38, sprite_spans_22 },
+    { 12, 10, 23, 38, sprite_spans_23 },
+    {  5, 10, 33, 38, sprite_spans_24 },
+    {  2, 11, 37, 37, sprite_spans_25 },
+    {  9, 10, 27, 38, sprite_spans_26 },
+    { 11, 10, 24, 38, sprite_spans_27 },
+};
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "simulation.h"
+
+// Compact encoding of the per-tick input stream, for recording and replay
+//
+// Each tick, step() hands both players one 32-bit ctrlState. Replaying the
+// same ctrlStates (plus the menu flags) through step() reproduces a match
+// exactly, whether the input originally came from a gamepad or an AI.
+//
+// Input rarely changes between ticks, so the stream only stores changes:
+//   1ccccccc                 the previous tick repeats c + 1 times (1-128)
+//   00000fff [P1] [P2] [F]   one tick where the fields flagged in fff changed:
+//                            bit 0 P1, bit 1 P2 - the new pressed bits
+//                            (~ctrlState) as a LEB128 varint, 1-2 bytes for
+//                            real buttons - and bit 2 the flags byte
+// Held input costs one byte per 5 seconds, a button press or release 3 bytes.
+// The stream starts from INPUT_FRAME_IDLE.
+
+#define INPUT_FLAG_START     0x01  // TickInputs.startPressed
+#define INPUT_FLAG_GAMEPAD1  0x02  // TickInputs.gamepadConnected[0]
+#define INPUT_FLAG_GAMEPAD2  0x04  // TickInputs.gamepadConnected[1]
+
+#define INPUT_RUN_TAG        0x80
+#define INPUT_MAX_RUN        128
+#define INPUT_CHANGED_P1     0x01
+#define INPUT_CHANGED_P2     0x02
+#define INPUT_CHANGED_FLAGS  0x04
+
+// Most bytes one call to inputEncode() can write
+#define INPUT_MAX_ENCODED 13
+
+// Recording files (see input_recorder.h) are a header then the stream
+#define RECORD_MAGIC 0x31435248        // "HRC1"
+#define RECORD_HEADER_SIZE 8           // Magic, tick the match started on, little-endian
+#define RECORD_PLAYBACK_SEED 0         // gameInit() seed a recording is replayed from
+
+// What step() consumed in one tick
+struct InputFrame {
+    uint32_t ctrlState[2];
+    uint8_t flags;
+};
+
+const InputFrame INPUT_FRAME_IDLE = { { CTRL_STATE_IDLE, CTRL_STATE_IDLE }, 0 };
+
+struct InputEncoder {
+    InputFrame last;
+    int pendingRun;  // Ticks equal to last, not written yet
+};
+
+struct InputDecoder {
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+    InputFrame current;
+    int runLeft;     // Repeats of current still to hand out
+};
+
+// Read back the input a tick actually used, after step()
+// Player ctrlState holds exactly what processInput saw; when a reset
+// overwrites it, the recorded value is overwritten the same way on replay.
+InputFrame inputFrameAfterStep(const GameState& gs, const TickInputs& in)
+{
+    InputFrame f;
+    f.ctrlState[0] = gs.player1.ctrlState;
+    f.ctrlState[1] = gs.player2.ctrlState;
+    f.flags = (in.startPressed ? INPUT_FLAG_START : 0) |
+              (in.gamepadConnected[0] ? INPUT_FLAG_GAMEPAD1 : 0) |
+              (in.gamepadConnected[1] ? INPUT_FLAG_GAMEPAD2 : 0);
+    return f;
+}
+
+// Inputs that make step() repeat a recorded tick, AI or not
+TickInputs tickInputsFromFrame(const InputFrame& f)
+{
+    TickInputs in;
+    in.buttons[0] = f.ctrlState[0];
+    in.buttons[1] = f.ctrlState[1];
+    in.gamepadConnected[0] = (f.flags & INPUT_FLAG_GAMEPAD1) != 0;
+    in.gamepadConnected[1] = (f.flags & INPUT_FLAG_GAMEPAD2) != 0;
+    in.startPressed = (f.flags & INPUT_FLAG_START) != 0;
+    in.overrideAI = true;
+    return in;
+}
+
+int writeVarint(uint8_t* out, uint32_t v)
+{
+    int n = 0;
+    while (v >= 0x80) {
+        out[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+void inputEncoderInit(InputEncoder* e)
+{
+    e->last = INPUT_FRAME_IDLE;
+    e->pendingRun = 0;
+}
+
+// Write out a pending run, if any; returns bytes written
+int inputEncodeFlush(InputEncoder* e, uint8_t* out)
+{
+    if (e->pendingRun == 0) return 0;
+    out[0] = INPUT_RUN_TAG | (uint8_t)(e->pendingRun - 1);
+    e->pendingRun = 0;
+    return 1;
+}
+
+// Add one tick; returns bytes written to out (at most INPUT_MAX_ENCODED)
+int inputEncode(InputEncoder* e, const InputFrame& f, uint8_t* out)
+{
+    uint8_t changed = 0;
+    if (f.ctrlState[0] != e->last.ctrlState[0]) changed |= INPUT_CHANGED_P1;
+    if (f.ctrlState[1] != e->last.ctrlState[1]) changed |= INPUT_CHANGED_P2;
+    if (f.flags != e->last.flags) changed |= INPUT_CHANGED_FLAGS;
+
+    if (changed == 0) {
+        if (++e->pendingRun < INPUT_MAX_RUN) return 0;
+        return inputEncodeFlush(e, out);
+    }
+
+    int n = inputEncodeFlush(e, out);
+    out[n++] = changed;
+    if (changed & INPUT_CHANGED_P1) n += writeVarint(out + n, ~f.ctrlState[0]);
+    if (changed & INPUT_CHANGED_P2) n += writeVarint(out + n, ~f.ctrlState[1]);
+    if (changed & INPUT_CHANGED_FLAGS) out[n++] = f.flags;
+    e->last = f;
+    return n;
+}
+
+void inputDecoderInit(InputDecoder* d, const uint8_t* data, size_t size)
+{
+    d->data = data;
+    d->size = size;
+    d->pos = 0;
+    d->current = INPUT_FRAME_IDLE;
+    d->runLeft = 0;
+}
+
+bool readVarint(InputDecoder* d, uint32_t* v)
+{
+    uint32_t result = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (d->pos >= d->size) return false;
+        uint8_t b = d->data[d->pos++];
+        result |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            *v = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Next recorded tick; false at the end of the stream or on corrupt data
+bool inputDecode(InputDecoder* d, InputFrame* out)
+{
+    if (d->runLeft > 0) {
+        d->runLeft--;
+        *out = d->current;
+        return true;
+    }
+    if (d->pos >= d->size) return false;
+
+    uint8_t tag = d->data[d->pos++];
+    if (tag & INPUT_RUN_TAG) {
+        d->runLeft = tag & ~INPUT_RUN_TAG;  // This tick plus runLeft more
+        *out = d->current;
+        return true;
+    }
+    if (tag == 0 || tag > (INPUT_CHANGED_P1 | INPUT_CHANGED_P2 | INPUT_CHANGED_FLAGS)) {
+        return false;
+    }
+
+    uint32_t pressed;
+    if (tag & INPUT_CHANGED_P1) {
+        if (!readVarint(d, &pressed)) return false;
+        d->current.ctrlState[0] = ~pressed;
+    }
+    if (tag & INPUT_CHANGED_P2) {
+        if (!readVarint(d, &pressed)) return false;
+        d->current.ctrlState[1] = ~pressed;
+    }
+    if (tag & INPUT_CHANGED_FLAGS) {
+        if (d->pos >= d->size) return false;
+        d->current.flags = d->data[d->pos++];
+    }
+    *out = d->current;
+    return true;
+}
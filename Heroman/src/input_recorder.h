@@ -0,0 +1,379 @@
+#pragma once
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <atomic>
+#include <stdlib.h>
+#include "input_record.h"
+#include "event_log.h"
+
+// Records every real match to flash and plays recordings back
+//
+// From the tick a player presses start until the game is back on the menu,
+// the simulation task encodes each tick's input (see input_record.h) into a
+// ring of RAM batches. A low-priority task writes finished batches to
+// LittleFS, one file per match in RECORD_DIR, so flash writes never hold up
+// a tick. If flash falls behind and the ring fills, the rest of that match
+// is dropped rather than waited for. The oldest recordings are deleted to
+// keep RECORD_MIN_FREE_BYTES free.
+//
+// Pressing SELECT on the menu replays the newest recording through step()
+// in place of the gamepads and AI; START stops the replay early. A replay
+// starts from a fresh gameInit() with RECORD_PLAYBACK_SEED, so its state
+// hashes (EV_STATE_HASH) match src/host/replay.cpp run on the same file.
+
+#define RECORD_DIR "/rec"
+#define RECORD_BATCH_SIZE 256          // Bytes per flash write
+#define RECORD_BATCH_COUNT 8           // Minutes of typical input
+#define RECORD_MIN_FREE_BYTES 65536
+#define RECORD_MAX_PRUNE 16            // Oldest recordings deleted per new one, at most
+#define RECORD_MAX_PLAYBACK_BYTES 32768
+#define RECORD_TASK_INTERVAL_MS 100
+
+struct RecordBatch {
+    std::atomic<bool> ready;   // Filled - owned by the writer task until it clears this
+    bool first;                // Starts a recording - goes to a new file
+    bool last;                 // Ends the recording - close the file after it
+    uint16_t length;
+    uint8_t data[RECORD_BATCH_SIZE];
+};
+
+// Playback hands the recording between the tasks:
+// IDLE -(sim)-> REQUESTED -(writer loads it)-> READY -(sim)-> PLAYING -(sim)-> FINISHED -(writer frees it)-> IDLE
+enum PlaybackState : uint8_t {
+    PLAYBACK_IDLE,
+    PLAYBACK_REQUESTED,
+    PLAYBACK_READY,
+    PLAYBACK_PLAYING,
+    PLAYBACK_FINISHED
+};
+
+struct InputRecorder {
+    RecordBatch batches[RECORD_BATCH_COUNT];
+    uint8_t writeBatch;        // Owned by the simulation task
+    uint8_t readBatch;         // Owned by the writer task
+
+    // Simulation task
+    bool recording;
+    bool batchOpen;            // batches[writeBatch] is being filled
+    bool firstBatch;           // Next batch opened starts the file
+    bool closePending;         // Overflowed after the file was started - still owes a last batch
+    InputEncoder encoder;
+    int lastGameState;
+    uint32_t startTick;
+    uint32_t bytesRecorded;
+
+    // Playback
+    std::atomic<uint8_t> playbackState;
+    uint8_t* playbackData;     // Stream after the header, allocated by the writer task
+    size_t playbackSize;
+    InputDecoder decoder;
+    uint32_t playbackTicks;
+
+    // Writer task
+    bool ready;                // LittleFS mounted
+    File file;
+    uint32_t nextIndex;        // File number for the next recording
+};
+
+InputRecorder recorder;
+
+// ---- Simulation task side ----
+
+// Make sure batches[writeBatch] can take bytes; false if the ring is full
+bool recorderOpenBatch()
+{
+    if (recorder.batchOpen) return true;
+
+    RecordBatch* b = &recorder.batches[recorder.writeBatch];
+    if (b->ready.load(std::memory_order_acquire)) return false;
+
+    b->first = recorder.firstBatch;
+    b->last = false;
+    b->length = 0;
+    recorder.firstBatch = false;
+    recorder.batchOpen = true;
+    return true;
+}
+
+void recorderPublishBatch(bool last)
+{
+    RecordBatch* b = &recorder.batches[recorder.writeBatch];
+    b->last = last;
+    b->ready.store(true, std::memory_order_release);
+    recorder.writeBatch = (recorder.writeBatch + 1) % RECORD_BATCH_COUNT;
+    recorder.batchOpen = false;
+}
+
+bool recorderWrite(const uint8_t* data, int length)
+{
+    for (int i = 0; i < length; i++) {
+        if (!recorderOpenBatch()) return false;
+        RecordBatch* b = &recorder.batches[recorder.writeBatch];
+        b->data[b->length++] = data[i];
+        if (b->length == RECORD_BATCH_SIZE) recorderPublishBatch(false);
+    }
+    recorder.bytesRecorded += length;
+    return true;
+}
+
+// Give the writer task the end of the recording so it closes the file
+bool recorderClose()
+{
+    if (!recorderOpenBatch()) return false;
+    recorderPublishBatch(true);
+    return true;
+}
+
+void recorderStart(const GameState& gs)
+{
+    recorder.recording = true;
+    recorder.firstBatch = true;
+    recorder.startTick = gs.tick;
+    recorder.bytesRecorded = 0;
+    inputEncoderInit(&recorder.encoder);
+
+    uint32_t header[2] = { RECORD_MAGIC, gs.tick };  // Little-endian on the ESP32
+    recorderWrite((const uint8_t*)header, RECORD_HEADER_SIZE);
+}
+
+void recorderOverflow()
+{
+    LOG_EVENT(EV_RECORD_OVERFLOW, recorder.bytesRecorded);
+    recorder.recording = false;
+    recorder.closePending = !recorder.firstBatch;
+}
+
+// Call after every step() with the inputs it was given
+void recordTick(const GameState& gs, const TickInputs& in)
+{
+    int previousState = recorder.lastGameState;
+    recorder.lastGameState = gs.gameState;
+
+    if (recorder.closePending && recorderClose()) {
+        recorder.closePending = false;
+    }
+
+    // Replays are not recorded again
+    if (recorder.playbackState.load(std::memory_order_relaxed) == PLAYBACK_PLAYING) return;
+
+    if (!recorder.recording) {
+        // A real player just started a match
+        if (previousState != GAME_MENU || gs.gameState != GAME_COUNTDOWN || recorder.closePending) return;
+        recorderStart(gs);
+    }
+
+    uint8_t encoded[INPUT_MAX_ENCODED];
+    int n = inputEncode(&recorder.encoder, inputFrameAfterStep(gs, in), encoded);
+    if (!recorderWrite(encoded, n)) {
+        recorderOverflow();
+        return;
+    }
+
+    // Back on the menu - the match and its victory sequence are complete
+    if (gs.gameState == GAME_MENU) {
+        n = inputEncodeFlush(&recorder.encoder, encoded);
+        if (!recorderWrite(encoded, n) || !recorderClose()) {
+            recorderOverflow();
+            return;
+        }
+        LOG_EVENT(EV_RECORD_END, gs.tick - recorder.startTick + 1, recorder.bytesRecorded);
+        recorder.recording = false;
+    }
+}
+
+void playbackStop(GameState& gs)
+{
+    LOG_EVENT(EV_PLAYBACK_END, recorder.playbackTicks);
+    recorder.playbackState.store(PLAYBACK_FINISHED, std::memory_order_release);
+
+    // Cut short mid-match - put the attract mode back
+    if (gs.gameState != GAME_MENU) {
+        returnToMenu(gs);
+        resetPlayers(gs);
+    }
+
+    // Playback started from a fixed seed - give the CPU fighters fresh ones
+    aiSeedRandom(&gs.aiPlayer1, esp_random());
+    aiSeedRandom(&gs.aiPlayer2, esp_random());
+}
+
+// Call before every step(): swaps in the recorded input while a replay runs
+void playbackTick(GameState& gs, TickInputs* in)
+{
+    uint8_t state = recorder.playbackState.load(std::memory_order_acquire);
+
+    if (state == PLAYBACK_IDLE && gs.gameState == GAME_MENU && !recorder.recording) {
+        for (int i = 0; i < 2; i++) {
+            if (in->gamepadConnected[i] && BUTTON_PRESSED(SELECT_BTN, in->buttons[i])) {
+                recorder.playbackState.store(PLAYBACK_REQUESTED, std::memory_order_release);
+                break;
+            }
+        }
+        return;
+    }
+
+    if (state == PLAYBACK_READY && gs.gameState == GAME_MENU) {
+        gameInit(gs, gs.screenWidth, gs.screenHeight, RECORD_PLAYBACK_SEED);
+        inputDecoderInit(&recorder.decoder, recorder.playbackData, recorder.playbackSize);
+        recorder.playbackTicks = 0;
+        recorder.playbackState.store(PLAYBACK_PLAYING, std::memory_order_relaxed);
+        LOG_EVENT(EV_PLAYBACK_START, recorder.playbackSize);
+        state = PLAYBACK_PLAYING;
+    }
+
+    if (state != PLAYBACK_PLAYING) return;
+
+    bool stopPressed = (in->gamepadConnected[0] && BUTTON_PRESSED(START_BTN, in->buttons[0])) ||
+                       (in->gamepadConnected[1] && BUTTON_PRESSED(START_BTN, in->buttons[1]));
+    InputFrame frame;
+    if (stopPressed || !inputDecode(&recorder.decoder, &frame)) {
+        playbackStop(gs);
+        return;
+    }
+
+    *in = tickInputsFromFrame(frame);
+    recorder.playbackTicks++;
+}
+
+// ---- Writer task side ----
+
+// Oldest and newest recording numbers; returns how many recordings there are
+int recorderScan(uint32_t* oldest, uint32_t* newest)
+{
+    int count = 0;
+    File dir = LittleFS.open(RECORD_DIR);
+    if (!dir) return 0;
+
+    for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+        const char* name = f.name();
+        const char* slash = strrchr(name, '/');  // Older cores return the full path
+        uint32_t index = strtoul(slash ? slash + 1 : name, nullptr, 10);
+        if (count == 0 || index < *oldest) *oldest = index;
+        if (count == 0 || index > *newest) *newest = index;
+        count++;
+    }
+    return count;
+}
+
+void recordingPath(char* path, size_t size, uint32_t index)
+{
+    snprintf(path, size, RECORD_DIR "/%05u.hrc", (unsigned)index);
+}
+
+// Delete the oldest recordings until there is room for more
+// Gives up when a delete fails or after RECORD_MAX_PRUNE of them, so a
+// filesystem error cannot keep the record task spinning on the same file.
+void recorderMakeRoom()
+{
+    char path[32];
+    for (int pass = 0; pass < RECORD_MAX_PRUNE; pass++) {
+        if (LittleFS.totalBytes() - LittleFS.usedBytes() >= RECORD_MIN_FREE_BYTES) return;
+        uint32_t oldest, newest;
+        if (recorderScan(&oldest, &newest) == 0) return;
+        recordingPath(path, sizeof(path), oldest);
+        if (!LittleFS.remove(path)) {
+            LOG_EVENT(EV_RECORD_PRUNE, oldest);
+            return;
+        }
+    }
+}
+
+void recorderOpenFile()
+{
+    if (recorder.file) recorder.file.close();  // Last batch of the previous match was lost
+    recorderMakeRoom();
+
+    char path[32];
+    recordingPath(path, sizeof(path), recorder.nextIndex);
+    recorder.file = LittleFS.open(path, FILE_WRITE);
+    LOG_EVENT(EV_RECORD_FILE, recorder.nextIndex, (bool)recorder.file);
+    recorder.nextIndex++;
+}
+
+// Load the newest recording for the simulation task to play
+void recorderLoadPlayback()
+{
+    uint32_t oldest, newest;
+    char path[32];
+    File f;
+    if (recorderScan(&oldest, &newest) > 0) {
+        recordingPath(path, sizeof(path), newest);
+        f = LittleFS.open(path, FILE_READ);
+    }
+
+    uint32_t header[2] = { 0, 0 };
+    size_t size = f ? f.size() : 0;
+    if (size <= RECORD_HEADER_SIZE || size > RECORD_MAX_PLAYBACK_BYTES + RECORD_HEADER_SIZE ||
+        f.read((uint8_t*)header, RECORD_HEADER_SIZE) != RECORD_HEADER_SIZE || header[0] != RECORD_MAGIC) {
+        recorder.playbackState.store(PLAYBACK_IDLE, std::memory_order_release);
+        return;
+    }
+
+    size -= RECORD_HEADER_SIZE;
+    recorder.playbackData = (uint8_t*)malloc(size);
+    if (recorder.playbackData == nullptr || f.read(recorder.playbackData, size) != size) {
+        free(recorder.playbackData);
+        recorder.playbackData = nullptr;
+        recorder.playbackState.store(PLAYBACK_IDLE, std::memory_order_release);
+        return;
+    }
+    recorder.playbackSize = size;
+    recorder.playbackState.store(PLAYBACK_READY, std::memory_order_release);
+}
+
+// Mount the filesystem - call from setup(), before the tasks start
+void recorderInit()
+{
+    for (int i = 0; i < RECORD_BATCH_COUNT; i++) {
+        recorder.batches[i].ready.store(false, std::memory_order_relaxed);
+    }
+    recorder.lastGameState = GAME_MENU;
+    recorder.playbackState.store(PLAYBACK_IDLE, std::memory_order_relaxed);
+
+    recorder.ready = LittleFS.begin(true);  // Format on first boot
+    if (!recorder.ready) {
+        Serial.println("LittleFS mount failed - matches will not be recorded");
+        return;
+    }
+    if (!LittleFS.exists(RECORD_DIR)) LittleFS.mkdir(RECORD_DIR);
+
+    uint32_t oldest, newest;
+    int count = recorderScan(&oldest, &newest);
+    recorder.nextIndex = count > 0 ? newest + 1 : 0;
+    Serial.printf("Input recorder ready: %d recordings, %u KB free\n", count,
+                  (unsigned)((LittleFS.totalBytes() - LittleFS.usedBytes()) / 1024));
+}
+
+// Write finished batches to flash and serve playback requests
+void recorderTask(void* param)
+{
+    for (;;) {
+        RecordBatch* b = &recorder.batches[recorder.readBatch];
+        while (b->ready.load(std::memory_order_acquire)) {
+            if (recorder.ready) {
+                if (b->first) recorderOpenFile();
+                if (recorder.file) recorder.file.write(b->data, b->length);
+                if (b->last && recorder.file) recorder.file.close();
+            }
+            b->ready.store(false, std::memory_order_release);
+            recorder.readBatch = (recorder.readBatch + 1) % RECORD_BATCH_COUNT;
+            b = &recorder.batches[recorder.readBatch];
+        }
+
+        uint8_t state = recorder.playbackState.load(std::memory_order_acquire);
+        if (state == PLAYBACK_REQUESTED) {
+            if (recorder.ready) {
+                recorderLoadPlayback();
+            } else {
+                recorder.playbackState.store(PLAYBACK_IDLE, std::memory_order_release);
+            }
+        } else if (state == PLAYBACK_FINISHED) {
+            free(recorder.playbackData);
+            recorder.playbackData = nullptr;
+            recorder.playbackState.store(PLAYBACK_IDLE, std::memory_order_release);
+        }
+
+        delay(RECORD_TASK_INTERVAL_MS);
+    }
+}
@@ -12,7 +12,9 @@
 
 #include <Arduino.h>
 #include "ESP32-HUB75-MatrixPanel-I2S-DMA.h"
+#include "render_target.h"
 #include <Wire.h>
+#include <esp_timer.h>
 
 // Pin definitions - different for each ESP32 variant
 #ifdef ESP32_S3_WROOM
@@ -91,9 +93,10 @@ uint16_t yellow = RGB565(31, 63, 0);  // Yellow
 uint16_t purple = RGB565(31, 0, 31);  // Purple
 // placeholder for the matrix object
 MatrixPanel_I2S_DMA *dma_display = nullptr;
+RenderTarget* renderTarget = nullptr;  // All game drawing goes here (the panel)
 
 uint16_t time_counter = 0, cycles = 0, fps = 0;
-unsigned long fps_timer;
+int64_t fps_timer;
 
 const uint8_t kMatrixWidth = PANE_WIDTH;
 const uint8_t kMatrixHeight = PANE_HEIGHT;
@@ -105,11 +108,11 @@ const uint8_t kMatrixHeight = PANE_HEIGHT;
 #include "button.h"
 #include "controller.h"
 #include "heroman.h"
-#include "ai_player.h"
+#include "input_recorder.h"
+#include "attract.h"
+#include "ai_expert.h"
 
-// Global AI controllers for both players
-AIController aiPlayer1 = {false, AI_BALANCED, nullptr, nullptr, 0, 0xFFFFFFFF, 0};
-AIController aiPlayer2 = {false, AI_AGGRESSIVE, nullptr, nullptr, 0, 0xFFFFFFFF, 0};
+void startTasks();
 
 void setup()
 {
@@ -119,6 +122,12 @@ void setup()
   Serial.println("\n\n=== Heroman Starting ===");
   Serial.println("Serial initialized");
 
+  // Binary event log - drained to Serial once the tasks are running
+  logInit();
+
+  // Matches are recorded to LittleFS by the recorder task
+  recorderInit();
+
   screen_Width = PANEL_WIDTH * PANELS_NUMBER;
   screen_Height = PANEL_HEIGHT;
   Serial.println("Configuring the matrix...");
@@ -166,6 +175,7 @@ void setup()
 
   // OK, now we can create our matrix object
   dma_display = new MatrixPanel_I2S_DMA(mxconfig);
+  renderTarget = dma_display;
 
   // let's adjust default brightness to about 75%
   dma_display->setBrightness8(75);    // range is 0-255, 0 - 0%, 255 - 100%
@@ -182,59 +192,256 @@ void setup()
   if( not dma_display->begin() )
       Serial.println("****** !KABOOM! I2S memory allocation failed ***********");
 
-  // Initialize hero game
-  init_hero();
-
-  // Initialize AI controllers with different personalities for interesting fights
-  initAI(&aiPlayer1, &player1, &player2, AI_BALANCED);    // Player 1: Balanced fighter
-  initAI(&aiPlayer2, &player2, &player1, AI_BALANCED);  // Player 2: Aggressive rushdown
-
-  // Enable both AI for attract mode (CPU vs CPU demo)
-  // Will be disabled when a real player presses start
-  enableAI(&aiPlayer1);
-  enableAI(&aiPlayer2);
+  // Initialize hero game - both AIs start enabled for attract mode (CPU vs CPU demo)
+  // and are disabled when a real player presses start. Each boot plays a
+  // different demo; the seed is logged so any match can be reproduced.
+  init_hero(esp_random());
 
   Serial.println("AI initialized - Attract mode enabled (CPU vs CPU demo)");
   Serial.println("Heroman initialized successfully!");
+
+  startTasks();
 }
 
 
-// Heartbeat counter for debugging
+// Dual-core pipeline
+//
+// The simulation task (Bluepad32, state machine, input, AI, combat) runs on
+// core 0 next to the Bluetooth stack. After each batch of fixed ticks it
+// publishes a RenderState snapshot and wakes the render task on core 1.
+// Neither task waits on the other, so Bluetooth and simulation jitter never
+// stall drawing and a slow frame never delays a tick.
+//
+// The render task draws every RENDER_FRAME_MS as well as on each new
+// snapshot, one tick behind, sliding the fighters between the two newest
+// snapshots (see interpolateRenderState) - two frames per tick rather than
+// the tick rate's 25.
+//
+// The simulation advances in fixed ticks of SIM_TICK_US, so frame-count
+// constants like FREEZE_FRAME_DELAY and hitCooldown always mean the same
+// wall-clock time.
+#define SIM_TICK_US 40000          // 25 ticks per second - all frame constants assume this
+#define MAX_TICKS_PER_LOOP 5       // Drop time rather than spiral after a long stall
+#define FRAME_STATS_INTERVAL_US 5000000
+
+#define SIM_TASK_CORE 0
+#define SIM_TASK_STACK 8192
+#define SIM_TASK_PRIORITY 2
+#define RENDER_TASK_CORE 1
+#define RENDER_TASK_STACK 4096
+#define RENDER_TASK_PRIORITY 1
+#define RENDER_FRAME_MS 20         // 50 fps - longer than a panel refresh, so each flip has shown before the next
+#define LOG_TASK_CORE 0
+#define LOG_TASK_STACK 2048
+#define LOG_TASK_PRIORITY 1        // Below the simulation, so logging never delays a tick
+#define LOG_DRAIN_INTERVAL_MS 20
+#define RECORD_TASK_CORE 0
+#define RECORD_TASK_STACK 4096
+#define RECORD_TASK_PRIORITY 1     // Flash writes wait for the simulation, never the other way round
+#define LOOKAHEAD_TASK_CORE 1
+#define LOOKAHEAD_TASK_STACK 4096
+#define LOOKAHEAD_TASK_PRIORITY 0  // Below the renderer - searches only fill the time between frames
+
+TaskHandle_t simTaskHandle = nullptr;
+TaskHandle_t renderTaskHandle = nullptr;
+TaskHandle_t logTaskHandle = nullptr;
+TaskHandle_t recordTaskHandle = nullptr;
+TaskHandle_t lookaheadTaskHandle = nullptr;
+
+// Simulation task state
+int64_t simLastTime = 0;
+int64_t simAccumulator = 0;
+uint32_t simDroppedTicks = 0;
+
+// Render task state: the two newest snapshots and the frame drawn between them
+RenderState renderPrevious;
+RenderState renderLatest;
+RenderState renderFrame;
+int64_t renderLatestAt = 0;        // When renderLatest arrived, 0 before the first snapshot
+bool renderCaughtUp = false;       // renderLatest drawn where it is - nothing left to slide
+int64_t renderDrawnAt = 0;         // When the last frame was started
+
+// Render task frame-time measurement, printed every FRAME_STATS_INTERVAL_US
+uint32_t statFirstTick = 0;
+int64_t statRenderTotal = 0;
+int64_t statRenderMax = 0;
+
+// Advance the game by one fixed tick
+void simulationTick()
+{
+  TickInputs in = readTickInputs();
+  playbackTick(game, &in);
+  attractTick(game, &in);
+  lookaheadCollect(game, in);
+  step(game, in);
+  recordTick(game, in);
+
+  if (lookaheadPost(game, in)) {
+    xTaskNotifyGive(lookaheadTaskHandle);
+  }
+}
 
-void loop(void)
+// One pass of the simulation task: run the ticks that are due, then publish
+void simulationStep()
 {
   // Update Bluepad32 state - must be called every loop
   BP32.update();
 
-  // Visual heartbeat - blink the white square every 50 loops (~2 seconds)
-  //loopCount++;
-  //if (loopCount % 50 == 0) {
-  //  dma_display->fillRect(60, 0, 8, 8, (loopCount % 100 == 0) ? 0x0000 : COLOR_WHITE);
-  //}
+  int64_t now = esp_timer_get_time();
+  if (simLastTime == 0) {
+    simLastTime = now;
+  }
+  simAccumulator += now - simLastTime;
+  simLastTime = now;
+
+  int ticks = 0;
+  while (simAccumulator >= SIM_TICK_US && ticks < MAX_TICKS_PER_LOOP) {
+    simulationTick();
+    simAccumulator -= SIM_TICK_US;
+    ticks++;
+  }
+
+  // Fell too far behind - forget the backlog instead of fast-forwarding
+  if (simAccumulator >= SIM_TICK_US) {
+    simDroppedTicks += simAccumulator / SIM_TICK_US;
+    simAccumulator %= SIM_TICK_US;
+  }
+
+  if (ticks > 0) {
+    RenderState* s = renderStateBegin();
+    captureRenderState(s, game);
+    s->tick = game.tick;
+    s->droppedTicks = simDroppedTicks;
+    renderStatePublish();
+    xTaskNotifyGive(renderTaskHandle);
+  } else {
+    // Let the Bluetooth and idle tasks run until the next tick is due
+    delay(1);
+  }
+}
+
+void reportFrameStats(const RenderState* s, int64_t now)
+{
+  if (now - fps_timer < FRAME_STATS_INTERVAL_US) return;
+
+  float seconds = (now - fps_timer) / 1000000.0f;
+  Serial.printf("fps %.1f  ticks/s %.1f  render avg %lldus max %lldus  dropped ticks %u\n",
+                fps / seconds, (s->tick - statFirstTick) / seconds,
+                (long long)(fps ? statRenderTotal / fps : 0), (long long)statRenderMax,
+                (unsigned)s->droppedTicks);
+
+  fps = 0;
+  statFirstTick = s->tick;
+  statRenderTotal = 0;
+  statRenderMax = 0;
+  fps_timer = now;
+}
+
+// One pass of the render task: take the newest snapshot, if there is one,
+// and draw the fighters as far along from the previous one as time has got
+void renderStep()
+{
+  int64_t renderStart = esp_timer_get_time();
+  const RenderState* fresh = renderStateAcquire();
+  if (fresh != nullptr) {
+    renderPrevious = (renderLatestAt != 0) ? renderLatest : *fresh;
+    renderLatest = *fresh;
+    renderLatestAt = renderStart;
+    renderCaughtUp = false;
+  } else if (renderLatestAt == 0 || renderCaughtUp) {
+    return;  // Nothing new to show
+  }
 
-  // Connection status indicators moved to menu screen only
+  int32_t elapsed = (int32_t)(renderStart - renderLatestAt);
+  interpolateRenderState(&renderFrame, &renderPrevious, &renderLatest, elapsed, SIM_TICK_US);
+  renderCaughtUp = elapsed >= SIM_TICK_US;
+  const RenderState* s = &renderFrame;
+  renderDrawnAt = renderStart;
+  drawFrame(s);
+  int64_t renderTime = esp_timer_get_time() - renderStart;
 
-  // Update game state machine
-  updateGameState();
+  statRenderTotal += renderTime;
+  if (renderTime > statRenderMax) statRenderMax = renderTime;
+  fps++;
 
-  // Process input for both players (including menu for AI demo mode)
-  processInput(&player1);
-  processInput(&player2);
+  reportFrameStats(s, esp_timer_get_time());
+}
 
-  // Check for combat collisions (only during active gameplay and menu demo)
-  if (gameState == GAME_PLAYING || gameState == GAME_MENU) {
-    checkCombat();
+void simTask(void* param)
+{
+  for (;;) {
+    simulationStep();
   }
+}
 
-  // Check for player-to-player pushback collision
-  if (gameState == GAME_PLAYING || gameState == GAME_MENU) {
-    checkPlayerPushback();
+void renderTask(void* param)
+{
+  fps_timer = esp_timer_get_time();
+  for (;;) {
+    // Sleep until the simulation publishes a new snapshot, or the next
+    // frame between snapshots is due
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RENDER_FRAME_MS));
+
+    // A snapshot that comes just after a frame waits its turn
+    int64_t sinceFrame = esp_timer_get_time() - renderDrawnAt;
+    if (sinceFrame < RENDER_FRAME_MS * 1000) {
+      delay((RENDER_FRAME_MS * 1000 - sinceFrame + 999) / 1000);
+    }
+    renderStep();
   }
+}
 
-  // Draw both players
-  drawFrame();
+// AI_EXPERT searches (see ai_expert.h), each capped at LOOKAHEAD_NODES and LOOKAHEAD_BUDGET_US
+void lookaheadTask(void* param)
+{
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    lookaheadServe();
+  }
+}
 
-  // 40ms delay for ~25 FPS
-  delay(40);
+// Drain the event log to Serial as binary frames (see event_log.h)
+// Blocking on a full UART only ever stalls this task, never the game.
+void logTask(void* param)
+{
+  uint8_t frame[LOG_FRAME_SIZE];
+  uint32_t reportedDrops = 0;
+
+  for (;;) {
+    LogRecord record;
+    while (logRead(&record)) {
+      Serial.write(frame, logEncode(record, frame));
+    }
+
+    uint32_t dropped = eventLog.dropped.load(std::memory_order_relaxed);
+    if (dropped != reportedDrops) {
+      LogRecord lost = { EV_LOG_DROPPED, logTick, { (int32_t)(dropped - reportedDrops), 0, 0, 0 } };
+      Serial.write(frame, logEncode(lost, frame));
+      reportedDrops = dropped;
+    }
+
+    delay(LOG_DRAIN_INTERVAL_MS);
+  }
 }
 
+void startTasks()
+{
+  // Render and lookahead tasks first so the simulation always has someone to notify
+  xTaskCreatePinnedToCore(renderTask, "render", RENDER_TASK_STACK, nullptr,
+                          RENDER_TASK_PRIORITY, &renderTaskHandle, RENDER_TASK_CORE);
+  xTaskCreatePinnedToCore(lookaheadTask, "lookahead", LOOKAHEAD_TASK_STACK, nullptr,
+                          LOOKAHEAD_TASK_PRIORITY, &lookaheadTaskHandle, LOOKAHEAD_TASK_CORE);
+  xTaskCreatePinnedToCore(simTask, "sim", SIM_TASK_STACK, nullptr,
+                          SIM_TASK_PRIORITY, &simTaskHandle, SIM_TASK_CORE);
+  xTaskCreatePinnedToCore(logTask, "log", LOG_TASK_STACK, nullptr,
+                          LOG_TASK_PRIORITY, &logTaskHandle, LOG_TASK_CORE);
+  xTaskCreatePinnedToCore(recorderTask, "record", RECORD_TASK_STACK, nullptr,
+                          RECORD_TASK_PRIORITY, &recordTaskHandle, RECORD_TASK_CORE);
+  Serial.println("Simulation and render tasks started");
+}
+
+void loop(void)
+{
+  // All work happens in simTask and renderTask
+  vTaskDelete(NULL);
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "player.h"
+#include "sprites.h"
+#include "animation.h"
+
+// What both fighters look like this tick, worked out once for everyone
+//
+// step() builds the Observation after input processing. Combat, pushback and
+// both AI controllers read it rather than each testing animation flags, frame
+// data and positions for themselves, so they all see the same tick. Combat
+// and pushback keep it up to date as they move fighters, so the AI's next
+// decision reads the tick exactly as it ended.
+
+// Arena coordinates of a frame box, mirrored when the fighter faces left
+// (right and bottom are exclusive)
+struct ArenaBox {
+    int left;
+    int top;
+    int right;
+    int bottom;
+};
+
+inline ArenaBox placeBox(const Player* p, const FrameBox& b) {
+    ArenaBox r;
+    r.left = (p->direction == MovingLeft) ? p->xPos + SPRITE_FRAME_WIDTH - b.x - b.w : p->xPos + b.x;
+    r.right = r.left + b.w;
+    r.top = p->yPos + b.y;
+    r.bottom = r.top + b.h;
+    return r;
+}
+
+// Arena box around the opaque pixels of a frame mask
+inline ArenaBox placeMask(const Player* p, const FrameMask& m) {
+    FrameBox b = { m.x, m.y, m.w, m.h };
+    return placeBox(p, b);
+}
+
+// One fighter, as the other one and the combat code see them
+struct FighterView {
+    uint8_t flags;            // ANIM_* flags of the current animation
+    bool isHit;               // In hit stagger
+    bool canPunch;
+    int8_t otherSide;         // The other fighter is to the left (-1), right (1) or level (0)
+    bool facing;              // Turned toward the other fighter
+    const FrameBoxes* boxes;  // Hit and hurt boxes of the sprite frame shown
+    const FrameMask* mask;    // Opaque pixels of the sprite frame shown
+    ArenaBox body;            // Arena box around those pixels
+};
+
+struct Observation {
+    int distance;              // Pixels between the fighters' x positions
+    FighterView fighters[2];   // Indexed by playerNumber - 1
+};
+
+// What a fighter's current frame shows, and where it is in the arena
+inline void observeFighter(FighterView* v, const Player* p) {
+    int image = animationImage(p->animation, p->animationFrameIndex);
+    v->flags = animations[p->animation].flags;
+    v->isHit = p->isHit;
+    v->canPunch = p->canPunch;
+    v->boxes = &fighter_boxes[image];
+    v->mask = &fighter_masks[image];
+    v->body = placeMask(p, *v->mask);
+}
+
+// Distance, and which way each fighter has to look for the other
+inline void observeSides(Observation* o, const Player* p1, const Player* p2) {
+    int8_t side = (p2->xPos > p1->xPos) - (p2->xPos < p1->xPos);  // Where p2 is from p1
+    o->distance = abs(p1->xPos - p2->xPos);
+
+    const Player* players[2] = { p1, p2 };
+    for (int i = 0; i < 2; i++) {
+        FighterView& v = o->fighters[i];
+        v.otherSide = (i == 0) ? side : -side;
+        v.facing = (players[i]->direction == MovingRight) ? v.otherSide > 0
+                 : (players[i]->direction == MovingLeft && v.otherSide < 0);
+    }
+}
+
+// Everything, after the fighters' animations may have changed
+inline void observe(Observation* o, const Player* p1, const Player* p2) {
+    observeFighter(&o->fighters[0], p1);
+    observeFighter(&o->fighters[1], p2);
+    observeSides(o, p1, p2);
+}
+
+// After pushback slid the fighters moved1 and moved2 pixels - their frames
+// are the same, so their bodies slide along rather than being placed again
+inline void observePush(Observation* o, const Player* p1, const Player* p2, int moved1, int moved2) {
+    o->fighters[0].body.left += moved1;
+    o->fighters[0].body.right += moved1;
+    o->fighters[1].body.left += moved2;
+    o->fighters[1].body.right += moved2;
+    observeSides(o, p1, p2);
+}
@@ -14,11 +14,10 @@ struct Player {
     int xPos;
     int yPos;
 
-    // Animation state
-    int animation;
-    int animationFrameIndex;
-    int* animationFrameset;
-    int animationDelayCounter;  // Counter to slow down animation frame rate
+    // Animation state (see animations[] in animation.h)
+    uint8_t animation;  // ANIMATION_* ID
+    uint8_t animationFrameIndex;  // Cursor into the animation's frames
+    uint8_t animationDelayCounter;  // Counter to slow down animation frame rate
     Direction direction;
 
     // Movement
@@ -28,15 +27,8 @@ struct Player {
     // Controller state
     uint32_t ctrlState;
 
-    // Sprite data
-    const unsigned short** spriteFrames;
-
-    // Flip buffer (each player needs their own for sprite flipping)
-    uint16_t flippedSpriteBuffer[SPRITE_FRAME_WIDTH * SPRITE_FRAME_HEIGHT];
-
-    // Mask buffer (each player needs their own to prevent DMA corruption)
-    // Size must be calculated row-by-row: bytesPerRow * height
-    uint8_t maskBuffer[((SPRITE_FRAME_WIDTH + 7) / 8) * SPRITE_FRAME_HEIGHT];
+    // Sprite data (frames and precomputed transparency masks)
+    const SpriteSet* sprites;
 
     // Player identification
     int playerNumber; // 1 or 2
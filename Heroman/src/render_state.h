@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include "sprites.h"
+
+// Snapshot of everything the renderer needs, handed from the simulation task
+// to the render task
+//
+// The simulation fills in a RenderState after each batch of ticks and
+// publishes it; the renderer only ever reads published snapshots, never the
+// live Player structs. Snapshots go through a lock-free triple buffer: one
+// slot is being written, one holds the latest published state, and one is
+// being drawn. Neither side ever waits for the other - the writer simply
+// replaces an unread snapshot with a newer one.
+
+// One fighter as it appears on screen
+struct FighterRenderState {
+    int16_t xPos;
+    uint8_t imageIndex;          // Index into sprites->frames
+    uint8_t direction;           // Direction - MovingLeft draws mirrored
+    uint8_t playerNumber;        // 1 or 2
+    int16_t health;              // 0-100
+    const SpriteSet* sprites;
+};
+
+struct RenderState {
+    FighterRenderState fighters[2];  // Player 1, player 2
+    uint8_t backFighter;             // Index drawn first, the other goes on top
+    uint8_t gameState;
+    uint8_t countdownStep;           // Index into countdownSteps during GAME_COUNTDOWN
+    uint8_t winnerNumber;            // Player number of the winner, 0 if none
+    bool pressStartVisible;          // Blink phase of "PRESS A TO START"
+    bool gamepadConnected[2];
+
+    // Running totals for frame statistics
+    uint32_t tick;
+    uint32_t droppedTicks;
+};
+
+#define RENDER_STATE_SLOTS 3
+#define RENDER_STATE_FRESH 0x80  // Set in latest when it has not been read yet
+
+struct RenderStateBuffer {
+    RenderState slots[RENDER_STATE_SLOTS];
+    std::atomic<uint8_t> latest;   // Slot index of the newest snapshot, plus RENDER_STATE_FRESH
+    uint8_t writeSlot;             // Owned by the simulation task
+    uint8_t readSlot;              // Owned by the render task
+};
+
+RenderStateBuffer renderStates = { {}, {0}, 1, 2 };
+
+// Slot the simulation may fill in - untouched by the renderer until published
+RenderState* renderStateBegin() {
+    return &renderStates.slots[renderStates.writeSlot];
+}
+
+// Make the slot from renderStateBegin() the latest snapshot
+void renderStatePublish() {
+    uint8_t previous = renderStates.latest.exchange(renderStates.writeSlot | RENDER_STATE_FRESH,
+                                                    std::memory_order_acq_rel);
+    renderStates.writeSlot = previous & ~RENDER_STATE_FRESH;
+}
+
+// Newest published snapshot, or nullptr if nothing was published since the last call
+// The returned state stays valid until the next call.
+const RenderState* renderStateAcquire() {
+    if (!(renderStates.latest.load(std::memory_order_acquire) & RENDER_STATE_FRESH)) {
+        return nullptr;
+    }
+    uint8_t previous = renderStates.latest.exchange(renderStates.readSlot, std::memory_order_acq_rel);
+    renderStates.readSlot = previous & ~RENDER_STATE_FRESH;
+    return &renderStates.slots[renderStates.readSlot];
+}
+
+// A frame between two snapshots, for drawing more often than the game ticks
+//
+// The renderer draws one tick behind: over the period after the newest
+// snapshot arrives, the fighters slide from their positions in the one
+// before it to their positions in the newest. Everything else - sprite
+// frames, health, text - is the newest snapshot's.
+#define RENDER_SLIDE_MAX_PX 16  // Further than this in one tick was a reset, not a step - jump
+
+void interpolateRenderState(RenderState* out, const RenderState* from, const RenderState* to,
+                            int32_t elapsed, int32_t period) {
+    *out = *to;
+    if (elapsed >= period || from->gameState != to->gameState) return;
+
+    for (int i = 0; i < 2; i++) {
+        int dx = to->fighters[i].xPos - from->fighters[i].xPos;
+        if (dx > RENDER_SLIDE_MAX_PX || dx < -RENDER_SLIDE_MAX_PX) continue;
+        out->fighters[i].xPos = (int16_t)(from->fighters[i].xPos + dx * elapsed / period);
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+// Where the draw functions in heroman.h send their pixels
+//
+// On the device this is the HUB75 DMA panel. The host build (HEROMAN_HOST)
+// draws into an in-memory framebuffer with the same interface instead, so the
+// render path can be run and timed off-device. The choice is made at compile
+// time - the panel build calls the DMA library directly, as before.
+
+#ifdef HEROMAN_HOST
+#include "host/framebuffer_target.h"
+typedef FramebufferTarget RenderTarget;
+#else
+#include "ESP32-HUB75-MatrixPanel-I2S-DMA.h"
+typedef MatrixPanel_I2S_DMA RenderTarget;
+#endif
+
+// Defined in main.cpp (or the host entry point)
+extern RenderTarget* renderTarget;
@@ -0,0 +1,1053 @@
+#pragma once
+
+// Fight simulation: both fighters, their AI, and the game state machine
+//
+// Everything that changes during a match lives in one GameState, advanced a
+// fixed tick at a time by step(). The simulation does no I/O and touches no
+// hardware - controller input arrives as TickInputs, and what happened is
+// reported through the non-blocking event log - so the same code runs on
+// the ESP32 and in native host builds.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "player.h"
+#include "sprites.h"
+#include "images.h"
+#include "ctrl_state.h"
+#include "animation.h"
+#include "event_log.h"
+#include "observation.h"
+#include "ai_player.h"
+
+#define MAX_SPEED 3  // Reduced from 7 for smoother movement
+
+// Game states
+#define GAME_MENU 0  // Start menu
+#define GAME_COUNTDOWN 1  // "Ready! Set! Fight!" countdown
+#define GAME_PLAYING 2
+#define GAME_FREEZE_FRAME 3  // Brief pause when killing blow lands
+#define GAME_VICTORY_PAUSE 4  // Pause before winner starts walking
+#define GAME_VICTORY_WALK 5  // Winner walks to loser
+#define GAME_VICTORY_TAUNT 6  // Winner does 4 squats
+#define GAME_RESET_COUNTDOWN 7  // Freeze before reset
+
+// Timing constants (in frames at 25 FPS)
+const int FREEZE_FRAME_DELAY = 30;  // ~1.2 seconds freeze on killing blow
+const int VICTORY_PAUSE_DELAY = 30;  // ~1.2 seconds pause before walk
+const int VICTORY_WALK_SPEED = 2;  // Slow walk speed
+const int SQUAT_HOLD_FRAMES = 15;  // ~0.6 seconds per squat
+const int RESET_FREEZE_DELAY = 50;  // ~2 seconds freeze before reset
+
+// The CPU's personality when one player takes it on alone
+// Build with -DVERSUS_CPU_PERSONALITY=AI_EXPERT to face the lookahead search
+// (ai_expert.h). The personality is part of the state hash, so native_replay
+// must be built with the same flag to follow the device's recordings.
+#ifndef VERSUS_CPU_PERSONALITY
+#define VERSUS_CPU_PERSONALITY AI_BALANCED
+#endif
+
+// State hash (see hashState) - 64-bit FNV-1a
+// Headless tools that only want throughput can build with -DSTATE_HASH_ENABLE=0
+#ifndef STATE_HASH_ENABLE
+#define STATE_HASH_ENABLE 1
+#endif
+#define STATE_HASH_OFFSET 0xCBF29CE484222325ull
+#define STATE_HASH_PRIME 0x00000100000001B3ull
+
+struct GameState {
+  Player player1;
+  Player player2;
+  AIController aiPlayer1;
+  AIController aiPlayer2;
+
+  int gameState;  // GAME_* state machine
+  Player* winner;
+  Player* loser;
+  int stateTimer;  // General purpose timer for various game states
+  int victorySquatCount;  // Count squats during victory taunt
+  bool winnerStartedOnLeft;  // Track which side winner started on for victory walk
+  int menuBlinkTimer;  // For blinking "PRESS A" text
+  uint32_t tick;  // Ticks simulated since gameInit
+  uint64_t stateHash;  // Running hash of every tick's state, see hashState()
+  Observation observation;  // Both fighters as this tick left them, see observation.h
+
+  // Totals for the current match, cleared whenever the fighters are reset
+  int hitsLanded[2];  // Hits that connected, by attacker
+  int squatDodges[2];  // High punches ducked, by defender
+
+  // Arena size - fighters are clamped to the screen and stand on the floor
+  int screenWidth;
+  int screenHeight;
+
+  bool lookahead;  // A copy being searched by AI_EXPERT (see lookaheadStep) - logs nothing
+};
+
+// Events about the fight itself, which lookahead copies replay thousands of times
+#define SIM_LOG_EVENT(gs, name, ...) \
+  do { if (!(gs).lookahead) LOG_EVENT(name, ##__VA_ARGS__); } while (0)
+
+// Controller input for one tick, gathered by the caller
+struct TickInputs {
+  uint32_t buttons[2];         // ctrlState for players 1 and 2 (ignored while their AI is enabled)
+  bool gamepadConnected[2];    // Human present - their AI is switched off when a match starts
+  bool startPressed;           // A real player pressed start on the menu
+  bool overrideAI;             // buttons drive both players even while their AI is enabled (replays)
+};
+
+#define NO_PLAYER -1
+
+int8_t playerIndex(const GameState& gs, const Player* p)
+{
+  if (p == &gs.player1) return 0;
+  if (p == &gs.player2) return 1;
+  return NO_PLAYER;
+}
+
+Player* playerAt(GameState& gs, int8_t index)
+{
+  if (index == 0) return &gs.player1;
+  if (index == 1) return &gs.player2;
+  return nullptr;
+}
+
+// A fighter as this tick's observation shows them
+const FighterView& viewOf(const GameState& gs, const Player* p)
+{
+  return gs.observation.fighters[p->playerNumber - 1];
+}
+
+// Rebuild the observation after the fighters' animations changed
+void observeFighters(GameState& gs)
+{
+  observe(&gs.observation, &gs.player1, &gs.player2);
+}
+
+// Safe position setter with validation
+void setPlayerXPos(Player* p, int newXPos) {
+  // Validate position
+  if (newXPos < -100 || newXPos > 200) {
+    return; // Don't allow invalid positions
+  }
+
+  p->xPos = newXPos;
+}
+
+int calcNextPos(GameState& gs, Player* p){
+	int result = p->xPos;
+
+  if(BUTTON_PRESSED(LEFT_BTN, p->ctrlState)) {
+    result = p->xPos - p->speed;
+    // Clamp to left edge instead of wrapping
+    if (result < 0) {
+      result = 0;
+      //Serial.printf("Player %d clamped to left edge\n", p->playerNumber);
+    }
+  }
+
+  if(BUTTON_PRESSED(RIGHT_BTN, p->ctrlState)) {
+    result = p->xPos + p->speed;
+    // Clamp to right edge instead of wrapping
+    int maxPos = gs.screenWidth - SPRITE_FRAME_WIDTH;
+    if (result > maxPos) {
+      result = maxPos;
+      //Serial.printf("Player %d clamped to right edge\n", p->playerNumber);
+    }
+  }
+
+	return result;
+}
+
+// A locked animation (a punch or block) plays through before input is read again
+bool isMidAnimation(Player* p){
+  return animationHas(p->animation, ANIM_LOCKED) &&
+         p->animationFrameIndex < animations[p->animation].frameCount - 1;
+}
+
+int calcNextAnimationIndex(Player* p){
+  return animationNextFrame(p->animation, p->animationFrameIndex);
+}
+
+void setAnimation(Player* p, int newAnimation)
+{
+  if(p->animation != newAnimation)
+  {
+    //Serial.printf("Changing Animation=%d\n", newAnimation);
+    p->animation = newAnimation;
+    p->animationFrameIndex = 0;
+    p->animationDelayCounter = 0;  // Reset delay counter on animation change
+  }
+  else
+  {
+    // Increment delay counter
+    p->animationDelayCounter++;
+
+    // Only advance animation frame when delay counter reaches threshold
+    if (p->animationDelayCounter >= animations[p->animation].ticksPerFrame) {
+      p->animationFrameIndex = calcNextAnimationIndex(p);
+      p->animationDelayCounter = 0;  // Reset counter
+    }
+  }
+
+}
+
+void setAnimationFromControlState(Player* p)
+{
+  // Check for blocking first (TRI_BTN = Y button)
+  if(BUTTON_PRESSED(TRI_BTN, p->ctrlState))
+  {
+    if(BUTTON_PRESSED(DOWN_BTN, p->ctrlState))
+    {
+      setAnimation(p, ANIMATION_SQUATBLOCKING);
+    }
+    else if(isMoving(p->ctrlState))
+    {
+      //setAnimation(p, ANIMATION_JUMPBLOCKING);
+    }
+    else
+    {
+      setAnimation(p, ANIMATION_BLOCKING);
+    }
+  }
+  // Check for high punch (PUNCH_BTN = A button)
+  else if(BUTTON_PRESSED(PUNCH_BTN, p->ctrlState) && p->canPunch)
+  {
+    // Set punch cooldown to prevent spamming
+    p->canPunch = false;
+    p->punchCooldown = 10; // 20 frames (~0.8 seconds) between punches
+
+    if(BUTTON_PRESSED(DOWN_BTN, p->ctrlState))
+    {
+      setAnimation(p, ANIMATION_SQUATPUNCHING_HIGH);
+    }
+    else if(isMoving(p->ctrlState))
+    {
+      //setAnimation(p, ANIMATION_JUMPPUNCHING_HIGH);
+    }
+    else
+    {
+      setAnimation(p, ANIMATION_PUNCHING_HIGH);
+    }
+  }
+  // Check for low punch (JUMP_BTN = B button, repurposed as low punch)
+  else if(BUTTON_PRESSED(JUMP_BTN, p->ctrlState) && p->canPunch)
+  {
+    // Set punch cooldown to prevent spamming
+    p->canPunch = false;
+    p->punchCooldown = 10; // 20 frames (~0.8 seconds) between punches
+
+    if(BUTTON_PRESSED(DOWN_BTN, p->ctrlState))
+    {
+      setAnimation(p, ANIMATION_SQUATPUNCHING_LOW);
+    }
+    else if(isMoving(p->ctrlState))
+    {
+      //setAnimation(p, ANIMATION_JUMPPUNCHING_LOW);
+    }
+    else
+    {
+      setAnimation(p, ANIMATION_PUNCHING_LOW);
+    }
+  }
+  else if(isMoving(p->ctrlState))
+  {
+    setAnimation(p, ANIMATION_RUNNING);
+  }
+  else
+  {
+    if(BUTTON_PRESSED(DOWN_BTN, p->ctrlState))
+    {
+      setAnimation(p, ANIMATION_SQUATTING);
+    }
+    else
+    {
+      setAnimation(p, ANIMATION_STOPPED);
+    }
+  }
+}
+
+
+// No longer needed - we now flip sprites at runtime
+// const unsigned short ** getCurrentDirectionalFrameset()
+// {
+//   return (lastKnown_Direction == MovingLeft) ? player_left_frames : player_right_frames;
+// }
+
+// Handle when a player gets hit
+void applyHit(GameState& gs, Player* victim, Player* attacker, bool isLowPunch)
+{
+  // Check if victim is already in hit stagger or dead/dying
+  if (victim->isHit || victim->isDead) {
+    return; // Already in hit stagger or dead
+  }
+  bool attackerOnLeft = viewOf(gs, victim).otherSide < 0;
+
+  // Apply damage
+  victim->health -= 10;
+  if (victim->health < 0) victim->health = 0;
+
+  // Check if this hit killed the player
+  if (victim->health <= 0) {
+    // Player is dead - start dying animation
+    victim->isDead = true;
+    setAnimation(victim, ANIMATION_DYING);
+
+    // Turn victim to face attacker
+    if (attackerOnLeft) {
+      victim->direction = MovingLeft;  // Attacker is on the left
+    } else {
+      victim->direction = MovingRight; // Attacker is on the right
+    }
+
+    // Trigger freeze frame and victory sequence
+    gs.gameState = GAME_FREEZE_FRAME;
+    gs.winner = attacker;
+    gs.loser = victim;
+    gs.stateTimer = FREEZE_FRAME_DELAY;
+
+    SIM_LOG_EVENT(gs, EV_GAME_OVER, attacker->playerNumber);
+
+    observeFighters(gs);
+    return; // Don't do stagger or pushback for death
+  }
+
+  // Set hit state with appropriate stagger animation
+  victim->isHit = true;
+  victim->hitCooldown = 15; // 15 frames of stagger (~0.6 seconds at 25 FPS)
+
+  // Set the appropriate stagger animation with correct frameset
+  if (isLowPunch) {
+    setAnimation(victim, ANIMATION_STAGGER_LOW);
+  } else {
+    setAnimation(victim, ANIMATION_STAGGER);
+  }
+
+  // Turn victim to face attacker
+  if (attackerOnLeft) {
+    victim->direction = MovingLeft;  // Attacker is on the left
+  } else {
+    victim->direction = MovingRight; // Attacker is on the right
+  }
+
+  // Push back slightly
+  int newPos;
+  if (attackerOnLeft) {
+    newPos = victim->xPos + 3; // Push right
+  } else {
+    newPos = victim->xPos - 3; // Push left
+  }
+
+  // Clamp to screen bounds
+  if (newPos < 0) {
+    newPos = 0;
+  }
+  if (newPos > gs.screenWidth - SPRITE_FRAME_WIDTH) {
+    newPos = gs.screenWidth - SPRITE_FRAME_WIDTH;
+  }
+
+  setPlayerXPos(victim, newPos);
+  observeFighters(gs);
+}
+
+
+void processInput(GameState& gs, Player* p)
+{
+  // Debug: Log processInput being called during menu
+  if (gs.gameState == GAME_MENU && gs.tick % 30 == 0) {
+    SIM_LOG_EVENT(gs, EV_PROCESS_INPUT, p->playerNumber, gs.gameState, p->ctrlState);
+  }
+
+  // During game over sequence, only process dying animation for loser
+  if (gs.gameState != GAME_PLAYING && gs.gameState != GAME_MENU && gs.gameState != GAME_COUNTDOWN && p != gs.loser) {
+    return; // Don't process input for winner during victory sequence
+  }
+
+  // During countdown, don't process any input - players should stand still
+  if (gs.gameState == GAME_COUNTDOWN) {
+    return;
+  }
+
+  // p->ctrlState was filled in by step() for this tick
+
+  // If player is dying or dead, handle death animation
+  if (p->isDead) {
+    if (p->animation == ANIMATION_DYING) {
+      // Advance dying animation
+      int frameCount = animations[ANIMATION_DYING].frameCount;
+      int nextFrame = calcNextAnimationIndex(p);
+
+      // Only move backwards during FREEZE_FRAME state, then freeze in place
+      if (gs.gameState == GAME_FREEZE_FRAME) {
+        // Move backwards during dying animation (away from attacker)
+        // Direction was set to face attacker, so move in that direction (backwards)
+        int dyingSpeed = 5;  // Slower than normal movement
+        int newPos = p->xPos;
+
+        if (p->direction == MovingLeft) {
+          newPos += dyingSpeed;  // Move left (backwards from right attacker)
+        } else {
+          newPos -= dyingSpeed;  // Move right (backwards from left attacker)
+        }
+
+        // Clamp to screen bounds
+        if (newPos < 0) newPos = 0;
+        if (newPos > gs.screenWidth - SPRITE_FRAME_WIDTH) {
+          newPos = gs.screenWidth - SPRITE_FRAME_WIDTH;
+        }
+        setPlayerXPos(p, newPos);
+      }
+
+      // Check if dying animation completed
+      if (p->animationFrameIndex >= frameCount - 1 && nextFrame == frameCount - 1) {
+        // Dying animation complete - transition to dead state
+        setAnimation(p, ANIMATION_DEAD);
+      } else {
+        p->animationFrameIndex = nextFrame;
+      }
+    }
+    // Dead or dying - no input processing
+    p->speed = 0;
+    return;
+  }
+
+  // Handle cooldowns
+  if (p->hitCooldown > 0) {
+    p->hitCooldown--;
+    if (p->hitCooldown == 0) {
+      p->isHit = false; // Recovery complete
+    }
+  }
+
+  if (p->punchCooldown > 0) {
+    p->punchCooldown--;
+    if (p->punchCooldown == 0) {
+      p->canPunch = true;
+    }
+  }
+
+  if (p->pushbackCooldown > 0) {
+    p->pushbackCooldown--;
+  }
+
+  // If player is in hit stagger, override all input
+  if (p->isHit) {
+    // Advance the current stagger animation frame (don't override - applyHit already set it)
+    p->animationFrameIndex = calcNextAnimationIndex(p);
+    p->speed = 0;
+    return; // Don't process other input while hit
+  }
+
+  if(isMidAnimation(p))
+  {
+    p->animationFrameIndex = calcNextAnimationIndex(p);
+  }
+  else
+  {
+    if(isMoving(p->ctrlState))
+    {
+      // Update direction based on which direction button is pressed
+      p->direction = BUTTON_PRESSED(LEFT_BTN, p->ctrlState) ? MovingLeft : p->direction;
+      p->direction = BUTTON_PRESSED(RIGHT_BTN, p->ctrlState) ? MovingRight : p->direction;
+      p->speed = MAX_SPEED;
+      int newPos = calcNextPos(gs, p);
+      setPlayerXPos(p, newPos);
+    }
+    else
+    {
+      p->speed = 0;
+    }
+
+    setAnimationFromControlState(p);
+
+  }
+
+}
+
+// Initialize a single player
+void initPlayer(GameState& gs, Player* p, int playerNumber, int startX, const SpriteSet* sprites)
+{
+  p->playerNumber = playerNumber;
+  p->xPos = startX;  // Direct assignment OK during init
+  LOG_EVENT(EV_INIT_PLAYER, p->playerNumber, p->xPos);
+  p->yPos = gs.screenHeight - STONEWALL_HEIGHT - SPRITE_FRAME_HEIGHT;
+  p->direction = MovingRight;
+  p->speed = 0;
+  p->animation = ANIMATION_STOPPED;
+  p->animationFrameIndex = 0;
+  p->animationDelayCounter = 0;  // Initialize animation delay counter
+  p->ctrlState = 0;
+  p->sprites = sprites;
+  p->imgIndex = 0;
+
+  // Initialize combat state
+  p->health = 100;
+  p->isHit = false;
+  p->hitCooldown = 0;
+  p->canPunch = true;
+  p->punchCooldown = 0;
+  p->isDead = false;
+
+  // Initialize pushback collision
+  p->pushbackCooldown = 0;
+}
+
+enum AttackResult {
+  ATTACK_MISS,
+  ATTACK_HIT,   // A hitbox overlaps a hurtbox
+  ATTACK_OVER,  // In reach, but every hitbox passes above the victim
+};
+
+// Most overlapping opaque pixels in any one row of window, 0 if the
+// fighters do not touch there. After the boxes are checked, b's rows are
+// shifted into line with a's and ANDed - one 64-bit AND per row of vertical
+// overlap, so never more than SPRITE_FRAME_HEIGHT.
+int pixelOverlap(const GameState& gs, Player* a, Player* b, const ArenaBox& window)
+{
+  const FighterView& va = viewOf(gs, a);
+  const FighterView& vb = viewOf(gs, b);
+  const FrameMask& ma = *va.mask;
+  const FrameMask& mb = *vb.mask;
+
+  ArenaBox both = window;
+  const ArenaBox* boxes[2] = { &va.body, &vb.body };
+  for (int i = 0; i < 2; i++) {
+    if (boxes[i]->left > both.left) both.left = boxes[i]->left;
+    if (boxes[i]->right < both.right) both.right = boxes[i]->right;
+    if (boxes[i]->top > both.top) both.top = boxes[i]->top;
+    if (boxes[i]->bottom < both.bottom) both.bottom = boxes[i]->bottom;
+  }
+  if (both.left >= both.right || both.top >= both.bottom) return 0;
+
+  // Bits are columns of a's cell; b's column c is a's column c + shift
+  const uint64_t* rowsA = (a->direction == MovingLeft) ? ma.left : ma.right;
+  const uint64_t* rowsB = (b->direction == MovingLeft) ? mb.left : mb.right;
+  int shift = b->xPos - a->xPos;
+  uint64_t columns = ((1ULL << (both.right - both.left)) - 1) << (both.left - a->xPos);
+
+  int widest = 0;
+  for (int y = both.top; y < both.bottom; y++) {
+    uint64_t rowB = rowsB[y - b->yPos - mb.y];
+    rowB = (shift >= 0) ? rowB << shift : rowB >> -shift;
+    uint64_t overlap = rowsA[y - a->yPos - ma.y] & rowB & columns;
+    if (overlap) {
+      int n = __builtin_popcountll(overlap);
+      if (n > widest) widest = n;
+    }
+  }
+  return widest;
+}
+
+// Intersect the attacker's active hitboxes with the victim's hurtboxes; the
+// boxes are the early-out, a hit needs the fist's pixels on the victim's
+AttackResult resolveAttack(const GameState& gs, Player* attacker, Player* victim)
+{
+  const FrameBoxes& a = *viewOf(gs, attacker).boxes;
+  const FrameBoxes& v = *viewOf(gs, victim).boxes;
+  AttackResult result = ATTACK_MISS;
+
+  for (int i = 0; i < a.hitCount; i++) {
+    ArenaBox hit = placeBox(attacker, a.hit[i]);
+    bool inBox = false;
+    for (int j = 0; j < v.hurtCount; j++) {
+      ArenaBox hurt = placeBox(victim, v.hurt[j]);
+      if (hit.right <= hurt.left || hit.left >= hurt.right) continue;
+      if (hit.bottom > hurt.top && hit.top < hurt.bottom) inBox = true;
+      else if (hit.bottom <= hurt.top) result = ATTACK_OVER;
+    }
+    if (inBox && pixelOverlap(gs, attacker, victim, hit) > 0) return ATTACK_HIT;
+  }
+  return result;
+}
+
+// One fighter's punch against the other
+// IMPORTANT: Victim must not already be in hit stagger (invincibility frames)
+void checkAttack(GameState& gs, Player* attacker, Player* victim)
+{
+  uint8_t attack = viewOf(gs, attacker).flags;
+  if (!(attack & ANIM_ATTACK)) return;
+
+  AttackResult result = resolveAttack(gs, attacker, victim);
+  bool invuln = viewOf(gs, victim).isHit;
+  SIM_LOG_EVENT(gs, EV_PUNCH, attacker->playerNumber, result, invuln);
+
+  if (invuln) return;
+
+  if (result == ATTACK_OVER && (viewOf(gs, victim).flags & ANIM_SQUAT)) {
+    // Punch goes over the crouched victim's head
+    SIM_LOG_EVENT(gs, EV_SQUAT_DODGE);
+    gs.squatDodges[victim->playerNumber - 1]++;
+  } else if (result == ATTACK_HIT) {
+    // Hit connects!
+    SIM_LOG_EVENT(gs, EV_HIT);
+    gs.hitsLanded[attacker->playerNumber - 1]++;
+    applyHit(gs, victim, attacker, !(attack & ANIM_HIGH));
+  }
+}
+
+// Check for combat interactions between players
+void checkCombat(GameState& gs)
+{
+  checkAttack(gs, &gs.player1, &gs.player2);
+  checkAttack(gs, &gs.player2, &gs.player1);
+}
+
+// Simple collision to reduce excessive overlap
+// Players can pass through each other occasionally (like classic fighting games)
+void checkPlayerPushback(GameState& gs)
+{
+  // Overlap of the silhouettes themselves, not of their cells
+  const FighterView& first = gs.observation.fighters[0];
+  int overlap = pixelOverlap(gs, &gs.player1, &gs.player2, first.body);
+
+  // Push back on any overlap to prevent passing through
+  if (overlap > 3) {
+    int x1 = gs.player1.xPos;
+    int x2 = gs.player2.xPos;
+
+    // Push both players back from each other
+    int pushAmount = 2;  // Enough to prevent circling but gentle enough for fighting
+
+    if (first.otherSide > 0) {
+      // P1 on left, P2 on right - push them apart
+      setPlayerXPos(&gs.player1, gs.player1.xPos - pushAmount);
+      setPlayerXPos(&gs.player2, gs.player2.xPos + pushAmount);
+    } else {
+      // P2 on left, P1 on right - push them apart
+      setPlayerXPos(&gs.player2, gs.player2.xPos - pushAmount);
+      setPlayerXPos(&gs.player1, gs.player1.xPos + pushAmount);
+    }
+    observePush(&gs.observation, &gs.player1, &gs.player2, gs.player1.xPos - x1, gs.player2.xPos - x2);
+  }
+}
+
+// Put both fighters back at their starting marks
+void resetPlayers(GameState& gs)
+{
+  initPlayer(gs, &gs.player1, 1, 10, &red_sprite_set);
+  initPlayer(gs, &gs.player2, 2, gs.screenWidth - 60, &blue_sprite_set);
+
+  for (int i = 0; i < 2; i++) {
+    gs.hitsLanded[i] = 0;
+    gs.squatDodges[i] = 0;
+  }
+}
+
+// Back to the CPU vs CPU attract mode on the menu
+void returnToMenu(GameState& gs)
+{
+  gs.gameState = GAME_MENU;
+  gs.winner = nullptr;
+  gs.loser = nullptr;
+  gs.menuBlinkTimer = 0;
+
+  // Re-enable AI for attract mode (CPU vs CPU demo), playing as gameInit()
+  // left it rather than as the last match's CPU
+  enableAI(&gs.aiPlayer1);
+  enableAI(&gs.aiPlayer2);
+  gs.aiPlayer1.personality = AI_BALANCED;
+  gs.aiPlayer2.personality = AI_BALANCED;
+  clearAIPlan(&gs.aiPlayer1);
+  clearAIPlan(&gs.aiPlayer2);
+  LOG_EVENT(EV_ATTRACT_MODE);
+}
+
+// Update game state machine
+void updateGameState(GameState& gs, const TickInputs& in)
+{
+  switch (gs.gameState) {
+    case GAME_MENU:
+      // CPU vs CPU demo mode runs until a real player presses start
+      {
+        gs.menuBlinkTimer++;
+
+        if (in.startPressed) {
+          // Real player(s) pressed start - begin countdown sequence
+          LOG_EVENT(EV_COUNTDOWN_START);
+          gs.gameState = GAME_COUNTDOWN;
+          gs.stateTimer = 0;  // Reset timer for countdown
+          gs.menuBlinkTimer = 0;
+
+          // Disable AI for players with connected gamepads
+          if (in.gamepadConnected[0]) {
+            disableAI(&gs.aiPlayer1);
+          } else {
+            enableAI(&gs.aiPlayer1);
+          }
+
+          if (in.gamepadConnected[1]) {
+            disableAI(&gs.aiPlayer2);
+          } else {
+            enableAI(&gs.aiPlayer2);
+          }
+          if (in.gamepadConnected[0] != in.gamepadConnected[1]) {
+            AIController* cpu = in.gamepadConnected[0] ? &gs.aiPlayer2 : &gs.aiPlayer1;
+            cpu->personality = VERSUS_CPU_PERSONALITY;
+          }
+          LOG_EVENT(EV_AI_ASSIGN, gs.aiPlayer1.enabled, gs.aiPlayer2.enabled);
+
+          // Initialize both players
+          resetPlayers(gs);
+        }
+      }
+      break;
+
+    case GAME_COUNTDOWN:
+      // Display "Ready! Set! Fight!" countdown sequence
+      {
+        gs.stateTimer++;
+
+        // Countdown timing (at ~25 FPS):
+        // Frames 0-40: "READY!" (1.6 seconds)
+        // Frames 41-80: "SET!" (1.6 seconds)
+        // Frames 81-105: "FIGHT!" (1.0 second)
+        // Frame 106+: Transition to GAME_PLAYING
+
+        if (gs.stateTimer >= 106) {
+          // Countdown complete - start game!
+          LOG_EVENT(EV_FIGHT);
+          gs.gameState = GAME_PLAYING;
+          gs.stateTimer = 0;
+        }
+      }
+      break;
+
+    case GAME_PLAYING:
+      // Normal gameplay - check for home button press to return to menu
+      // (ctrlState already holds this tick's input, see step())
+      if (BUTTON_PRESSED(START_BTN, gs.player1.ctrlState) || BUTTON_PRESSED(START_BTN, gs.player2.ctrlState)) {
+        LOG_EVENT(EV_HOME_PRESSED);
+        returnToMenu(gs);
+      }
+      break;
+
+    case GAME_FREEZE_FRAME:
+      // Freeze frame on killing blow
+      gs.stateTimer--;
+      if (gs.stateTimer <= 0) {
+        // Transition to victory pause
+        gs.gameState = GAME_VICTORY_PAUSE;
+        gs.stateTimer = VICTORY_PAUSE_DELAY;
+        LOG_EVENT(EV_FREEZE_END);
+      }
+      break;
+
+    case GAME_VICTORY_PAUSE:
+      // Brief pause before winner walks
+      gs.stateTimer--;
+      if (gs.stateTimer <= 0) {
+        // Transition to victory walk
+        gs.gameState = GAME_VICTORY_WALK;
+        gs.winner->speed = VICTORY_WALK_SPEED;
+        setAnimation(gs.winner, ANIMATION_RUNNING);
+
+        // Determine which side winner starts on and lock it in
+        gs.winnerStartedOnLeft = (gs.winner->xPos < gs.loser->xPos);
+        LOG_EVENT(EV_VICTORY_WALK, gs.winnerStartedOnLeft);
+      }
+      break;
+
+    case GAME_VICTORY_WALK:
+      {
+        // Winner walks to stand over the loser's head (far edge of sprite)
+        // Use the starting position to determine direction, not current position
+        int targetX;
+        if (gs.winnerStartedOnLeft) {
+          // Winner started on left, walk right to stand over loser's head (right side)
+          // Loser's head is at the far edge, so walk to loser + half sprite width
+          targetX = gs.loser->xPos + (SPRITE_FRAME_WIDTH / 4);
+          gs.winner->direction = MovingRight;
+          int newPos = gs.winner->xPos + VICTORY_WALK_SPEED;
+
+          // Debug every 10 ticks
+          if (gs.tick % 10 == 0) {
+            LOG_EVENT(EV_WALK, gs.winner->xPos, gs.loser->xPos, targetX, newPos);
+          }
+
+          if (newPos >= targetX) {
+            newPos = targetX;
+            // Reached target - start taunt
+            gs.gameState = GAME_VICTORY_TAUNT;
+            gs.victorySquatCount = 0;
+            gs.stateTimer = 0;
+            setAnimation(gs.winner, ANIMATION_SQUATTING);
+            LOG_EVENT(EV_TAUNT_START, newPos);
+            // TODO: Later feature - make winner face camera (turn to face right if P1, left if P2)
+          }
+          setPlayerXPos(gs.winner, newPos);
+        } else {
+          // Winner started on right, walk left to stand over loser's head (left side)
+          // Loser's head is at the far edge, so walk to loser - half sprite width
+          targetX = gs.loser->xPos - (SPRITE_FRAME_WIDTH / 4);
+          gs.winner->direction = MovingLeft;
+          int newPos = gs.winner->xPos - VICTORY_WALK_SPEED;
+
+          // Debug every 10 ticks
+          if (gs.tick % 10 == 0) {
+            LOG_EVENT(EV_WALK, gs.winner->xPos, gs.loser->xPos, targetX, newPos);
+          }
+
+          if (newPos <= targetX) {
+            newPos = targetX;
+            // Reached target - start taunt
+            gs.gameState = GAME_VICTORY_TAUNT;
+            gs.victorySquatCount = 0;
+            gs.stateTimer = 0;
+            setAnimation(gs.winner, ANIMATION_SQUATTING);
+            LOG_EVENT(EV_TAUNT_START, newPos);
+            // TODO: Later feature - make winner face camera (turn to face right if P1, left if P2)
+          }
+          setPlayerXPos(gs.winner, newPos);
+        }
+
+        // Advance walking animation
+        gs.winner->animationFrameIndex = calcNextAnimationIndex(gs.winner);
+      }
+      break;
+
+    case GAME_VICTORY_TAUNT:
+      // Do 4 squats (toggle between squat and stand)
+      gs.stateTimer++;
+      if (gs.stateTimer >= SQUAT_HOLD_FRAMES) {
+        gs.stateTimer = 0;
+
+        // Toggle animation between squat and stand
+        if (gs.winner->animation == ANIMATION_SQUATTING) {
+          setAnimation(gs.winner, ANIMATION_STOPPED);
+        } else {
+          setAnimation(gs.winner, ANIMATION_SQUATTING);
+          gs.victorySquatCount++;
+          LOG_EVENT(EV_SQUAT, gs.victorySquatCount);
+
+          if (gs.victorySquatCount >= 4) {
+            // Taunt complete - freeze for a moment before reset
+            gs.gameState = GAME_RESET_COUNTDOWN;
+            gs.stateTimer = RESET_FREEZE_DELAY;
+            LOG_EVENT(EV_TAUNT_DONE);
+          }
+        }
+      }
+      break;
+
+    case GAME_RESET_COUNTDOWN:
+      // Freeze for a moment, then return to attract mode
+      gs.stateTimer--;
+      if (gs.stateTimer <= 0) {
+        // Return to menu for attract mode (CPU vs CPU demo)
+        returnToMenu(gs);
+
+        // Reset both players
+        resetPlayers(gs);
+      }
+      break;
+  }
+}
+
+// Start a fresh simulation on the menu, CPU vs CPU
+// Everything after this follows from seed and the inputs given to step().
+void gameInit(GameState& gs, int screenWidth, int screenHeight, uint32_t seed)
+{
+  memset(&gs, 0, sizeof(gs));
+  gs.screenWidth = screenWidth;
+  gs.screenHeight = screenHeight;
+  gs.gameState = GAME_MENU;
+  gs.stateHash = STATE_HASH_OFFSET;
+  LOG_EVENT(EV_GAME_SEED, seed);
+
+  resetPlayers(gs);
+  initAI(&gs.aiPlayer1, &gs.player1, &gs.player2, &gs.observation, AI_BALANCED, seed);
+  initAI(&gs.aiPlayer2, &gs.player2, &gs.player1, &gs.observation, AI_BALANCED, seed + 1);
+  enableAI(&gs.aiPlayer1);
+  enableAI(&gs.aiPlayer2);
+  observeFighters(gs);
+}
+
+// ---- State hash ----
+
+inline uint64_t hashWord(uint64_t h, uint32_t v)
+{
+  return (h ^ v) * STATE_HASH_PRIME;
+}
+
+uint64_t hashPlayer(uint64_t h, const Player& p)
+{
+  h = hashWord(h, p.xPos);
+  h = hashWord(h, p.yPos);
+  h = hashWord(h, p.animation);
+  h = hashWord(h, p.animationFrameIndex);
+  h = hashWord(h, p.animationDelayCounter);
+  h = hashWord(h, p.direction);
+  h = hashWord(h, p.speed);
+  h = hashWord(h, p.imgIndex);
+  h = hashWord(h, p.ctrlState);
+  h = hashWord(h, p.playerNumber);
+  h = hashWord(h, p.health);
+  h = hashWord(h, p.isHit | (p.canPunch << 1) | (p.isDead << 2));
+  h = hashWord(h, p.hitCooldown);
+  h = hashWord(h, p.punchCooldown);
+  h = hashWord(h, p.pushbackCooldown);
+  return h;
+}
+
+uint64_t hashAI(uint64_t h, const AIController& ai)
+{
+  h = hashWord(h, ai.enabled);
+  h = hashWord(h, ai.personality);
+  h = hashWord(h, ai.decisionTimer);
+  h = hashWord(h, ai.currentAction);
+  h = hashWord(h, ai.actionDuration);
+  h = hashWord(h, ai.rngState);
+  h = hashWord(h, ai.plannedAction);
+  h = hashWord(h, ai.plannedDuration);
+  return h;
+}
+
+// Fold this tick's simulation state into the running hash h
+// Fields are hashed one 32-bit word at a time, by value - never padding or
+// pointers - so the ESP32 and a host build produce the same stream for the
+// same inputs, and the first tick where two streams differ is where the
+// simulations diverged. Costs about fifty multiplies per tick.
+uint64_t hashState(const GameState& gs, uint64_t h)
+{
+  h = hashPlayer(h, gs.player1);
+  h = hashPlayer(h, gs.player2);
+  h = hashAI(h, gs.aiPlayer1);
+  h = hashAI(h, gs.aiPlayer2);
+  h = hashWord(h, gs.gameState);
+  h = hashWord(h, playerIndex(gs, gs.winner));
+  h = hashWord(h, playerIndex(gs, gs.loser));
+  h = hashWord(h, gs.stateTimer);
+  h = hashWord(h, gs.victorySquatCount);
+  h = hashWord(h, gs.winnerStartedOnLeft);
+  h = hashWord(h, gs.menuBlinkTimer);
+  h = hashWord(h, gs.tick);
+  for (int i = 0; i < 2; i++) {
+    h = hashWord(h, gs.hitsLanded[i]);
+    h = hashWord(h, gs.squatDodges[i]);
+  }
+  return h;
+}
+
+// Advance the simulation by one tick
+// Each player's input is read exactly once per tick: from their AI while it
+// is enabled (unless in.overrideAI), otherwise from in.buttons.
+void step(GameState& gs, const TickInputs& in)
+{
+  gs.tick++;
+  logSetTick(gs.tick);
+
+  if (gs.gameState == GAME_PLAYING || gs.gameState == GAME_MENU) {
+    bool useAI1 = gs.aiPlayer1.enabled && !in.overrideAI;
+    bool useAI2 = gs.aiPlayer2.enabled && !in.overrideAI;
+    // A plan is only played by its own AI, so an overridden one cannot
+    // carry a stale plan into the state hash or a later decision
+    if (!useAI1) clearAIPlan(&gs.aiPlayer1);
+    if (!useAI2) clearAIPlan(&gs.aiPlayer2);
+    gs.player1.ctrlState = useAI1 ? ai_make_decision(&gs.aiPlayer1) : in.buttons[0];
+    gs.player2.ctrlState = useAI2 ? ai_make_decision(&gs.aiPlayer2) : in.buttons[1];
+  }
+
+  updateGameState(gs, in);
+  processInput(gs, &gs.player1);
+  processInput(gs, &gs.player2);
+  observeFighters(gs);
+
+  if (gs.gameState == GAME_PLAYING || gs.gameState == GAME_MENU) {
+    checkCombat(gs);
+    checkPlayerPushback(gs);
+  }
+
+  if (STATE_HASH_ENABLE) {
+    gs.stateHash = hashState(gs, gs.stateHash);
+    LOG_EVENT(EV_STATE_HASH, (uint32_t)(gs.stateHash >> 32), (uint32_t)gs.stateHash);
+  }
+}
+
+// Advance a lookahead copy of a fight by one tick with the given buttons
+// Only what step() does mid-fight: no AI, state machine, logging or hash,
+// so it costs two processInput() calls and the collision tests. The copy is
+// a plain struct copy of the GameState with lookahead set.
+void lookaheadStep(GameState& gs, uint32_t buttons1, uint32_t buttons2)
+{
+  gs.tick++;
+  gs.player1.ctrlState = buttons1;
+  gs.player2.ctrlState = buttons2;
+  processInput(gs, &gs.player1);
+  processInput(gs, &gs.player2);
+  observeFighters(gs);
+  checkCombat(gs);
+  checkPlayerPushback(gs);
+}
+
+// ---- Snapshots ----
+
+// Everything needed to resume a match bit-exactly, for rollback, replays
+// and rematches. Players are referred to by index rather than by pointer,
+// so a snapshot can be loaded into any GameState set up by gameInit() for
+// the same arena. Player's sprite pointer refers to constant data, so a
+// snapshot is only valid in the firmware that took it. About 300 bytes;
+// saving or loading is a plain copy.
+struct GameSnapshot {
+  Player players[2];
+  AIController ai[2];  // self, opponent and observation are rebound on load
+  int gameState;
+  int8_t winner;  // Player index, or NO_PLAYER
+  int8_t loser;
+  bool winnerStartedOnLeft;
+  int stateTimer;
+  int victorySquatCount;
+  int menuBlinkTimer;
+  uint32_t tick;
+  uint64_t stateHash;
+  int hitsLanded[2];
+  int squatDodges[2];
+};
+
+void saveSnapshot(const GameState& gs, GameSnapshot* s)
+{
+  s->players[0] = gs.player1;
+  s->players[1] = gs.player2;
+  s->ai[0] = gs.aiPlayer1;
+  s->ai[1] = gs.aiPlayer2;
+  s->gameState = gs.gameState;
+  s->winner = playerIndex(gs, gs.winner);
+  s->loser = playerIndex(gs, gs.loser);
+  s->winnerStartedOnLeft = gs.winnerStartedOnLeft;
+  s->stateTimer = gs.stateTimer;
+  s->victorySquatCount = gs.victorySquatCount;
+  s->menuBlinkTimer = gs.menuBlinkTimer;
+  s->tick = gs.tick;
+  s->stateHash = gs.stateHash;
+  for (int i = 0; i < 2; i++) {
+    s->hitsLanded[i] = gs.hitsLanded[i];
+    s->squatDodges[i] = gs.squatDodges[i];
+  }
+}
+
+// Put gs back exactly as it was when s was saved (the arena size is kept)
+void loadSnapshot(GameState& gs, const GameSnapshot& s)
+{
+  gs.player1 = s.players[0];
+  gs.player2 = s.players[1];
+  gs.aiPlayer1 = s.ai[0];
+  gs.aiPlayer2 = s.ai[1];
+  gs.aiPlayer1.self = &gs.player1;
+  gs.aiPlayer1.opponent = &gs.player2;
+  gs.aiPlayer2.self = &gs.player2;
+  gs.aiPlayer2.opponent = &gs.player1;
+  gs.aiPlayer1.observation = &gs.observation;
+  gs.aiPlayer2.observation = &gs.observation;
+  gs.gameState = s.gameState;
+  gs.winner = playerAt(gs, s.winner);
+  gs.loser = playerAt(gs, s.loser);
+  gs.winnerStartedOnLeft = s.winnerStartedOnLeft;
+  gs.stateTimer = s.stateTimer;
+  gs.victorySquatCount = s.victorySquatCount;
+  gs.menuBlinkTimer = s.menuBlinkTimer;
+  gs.tick = s.tick;
+  gs.stateHash = s.stateHash;
+  for (int i = 0; i < 2; i++) {
+    gs.hitsLanded[i] = s.hitsLanded[i];
+    gs.squatDodges[i] = s.squatDodges[i];
+  }
+  observeFighters(gs);
+}
@@ -22,136 +22,65 @@
 #endif
 
 
-// Left-facing sprites removed - using runtime horizontal flip instead
-
-#include "images/sprite_right_red_00.h"
-#include "images/sprite_right_red_01.h"
-#include "images/sprite_right_red_02.h"
-#include "images/sprite_right_red_03.h"
-#include "images/sprite_right_red_04.h"
-#include "images/sprite_right_red_05.h"
-#include "images/sprite_right_red_06.h"
-#include "images/sprite_right_red_07.h"
-#include "images/sprite_right_red_08.h"
-#include "images/sprite_right_red_09.h"
-#include "images/sprite_right_red_10.h"
-#include "images/sprite_right_red_11.h"
-#include "images/sprite_right_red_12.h"
-#include "images/sprite_right_red_13.h"
-#include "images/sprite_right_red_14.h"
-#include "images/sprite_right_red_15.h"
-#include "images/sprite_right_red_16.h"
-#include "images/sprite_right_red_17.h"
-#include "images/sprite_right_red_18.h"
-#include "images/sprite_right_red_19.h"
-#include "images/sprite_right_red_20.h"
-#include "images/sprite_right_red_21.h"
-#include "images/sprite_right_red_22.h"
-#include "images/sprite_right_red_23.h"
-#include "images/sprite_right_red_24.h"
-#include "images/sprite_right_red_25.h"
-#include "images/sprite_right_red_26.h"
-#include "images/sprite_right_red_27.h"
-
-#include "images/sprite_right_blue_00.h"
-#include "images/sprite_right_blue_01.h"
-#include "images/sprite_right_blue_02.h"
-#include "images/sprite_right_blue_03.h"
-#include "images/sprite_right_blue_04.h"
-#include "images/sprite_right_blue_05.h"
-#include "images/sprite_right_blue_06.h"
-#include "images/sprite_right_blue_07.h"
-#include "images/sprite_right_blue_08.h"
-#include "images/sprite_right_blue_09.h"
-#include "images/sprite_right_blue_10.h"
-#include "images/sprite_right_blue_11.h"
-#include "images/sprite_right_blue_12.h"
-#include "images/sprite_right_blue_13.h"
-#include "images/sprite_right_blue_14.h"
-#include "images/sprite_right_blue_15.h"
-#include "images/sprite_right_blue_16.h"
-#include "images/sprite_right_blue_17.h"
-#include "images/sprite_right_blue_18.h"
-#include "images/sprite_right_blue_19.h"
-#include "images/sprite_right_blue_20.h"
-#include "images/sprite_right_blue_21.h"
-#include "images/sprite_right_blue_22.h"
-#include "images/sprite_right_blue_23.h"
-#include "images/sprite_right_blue_24.h"
-#include "images/sprite_right_blue_25.h"
-#include "images/sprite_right_blue_26.h"
-#include "images/sprite_right_blue_27.h"
-
-
-// player_left_frames array removed - sprites are flipped at runtime instead
-
-const unsigned short *player_right_frames[] = {
-                                          sprite_right_red_00
-                                        , sprite_right_red_01
-                                        , sprite_right_red_02
-                                        , sprite_right_red_03
-                                        , sprite_right_red_04
-                                        , sprite_right_red_05
-                                        , sprite_right_red_06
-                                        , sprite_right_red_07
-                                        , sprite_right_red_08
-                                        , sprite_right_red_09
-                                        , sprite_right_red_10
-                                        , sprite_right_red_11
-                                        , sprite_right_red_12
-                                        , sprite_right_red_13
-                                        , sprite_right_red_14
-                                        , sprite_right_red_15
-                                        , sprite_right_red_16
-                                        , sprite_right_red_17
-                                        , sprite_right_red_18
-                                        , sprite_right_red_19
-                                        , sprite_right_red_20
-                                        , sprite_right_red_21
-                                        , sprite_right_red_22
-                                        , sprite_right_red_23
-                                        , sprite_right_red_24
-                                        , sprite_right_red_25
-                                        , sprite_right_red_26
-                                        , sprite_right_red_27
-                                        };
-
-const unsigned short *player_right_blue_frames[] = {
-                                          sprite_right_blue_00
-                                        , sprite_right_blue_01
-                                        , sprite_right_blue_02
-                                        , sprite_right_blue_03
-                                        , sprite_right_blue_04
-                                        , sprite_right_blue_05
-                                        , sprite_right_blue_06
-                                        , sprite_right_blue_07
-                                        , sprite_right_blue_08
-                                        , sprite_right_blue_09
-                                        , sprite_right_blue_10
-                                        , sprite_right_blue_11
-                                        , sprite_right_blue_12
-                                        , sprite_right_blue_13
-                                        , sprite_right_blue_14
-                                        , sprite_right_blue_15
-                                        , sprite_right_blue_16
-                                        , sprite_right_blue_17
-                                        , sprite_right_blue_18
-                                        , sprite_right_blue_19
-                                        , sprite_right_blue_20
-                                        , sprite_right_blue_21
-                                        , sprite_right_blue_22
-                                        , sprite_right_blue_23
-                                        , sprite_right_blue_24
-                                        , sprite_right_blue_25
-                                        , sprite_right_blue_26
-                                        , sprite_right_blue_27
-                                        };
-
-
-
-
-
-
+// Fighter frames, span-encoded from images/sprite_right_*.h by tools/gen_sprites.py
+// The raw ImgConv headers are the source assets and are no longer compiled in.
+// All fighters share one palette-indexed frame set; colours come from a palette.
+// Left-facing frames are mirrored while blitting.
+
+// One frame, trimmed to the box around its opaque pixels within the 46x50 cell
+struct SpriteFrame {
+    uint8_t trimX;
+    uint8_t trimY;
+    uint8_t trimWidth;
+    uint8_t trimHeight;
+    const uint8_t* spans;  // Span data covering only the trimmed box
+};
+
+#include "images/sprite_spans.h"
+
+// Combat frame data: where a frame can be hit, and where its punch lands
+// Boxes are in the right-facing 46x50 cell and mirror with the sprite.
+struct FrameBox {
+    uint8_t x;
+    uint8_t y;
+    uint8_t w;
+    uint8_t h;
+};
+
+#define FRAME_MAX_HURTBOXES 3
+#define FRAME_MAX_HITBOXES 1
+
+struct FrameBoxes {
+    uint8_t hurtCount;
+    uint8_t hitCount;  // Non-zero only on a punch's active frames
+    FrameBox hurt[FRAME_MAX_HURTBOXES];
+    FrameBox hit[FRAME_MAX_HITBOXES];
+};
+
+#include "images/sprite_boxes.h"
+
+// Pixel collision masks: one row per uint64_t, bit x set where column x of
+// the cell is opaque (46 columns fit one word). The box is the frame's trim
+// rect in the right-facing cell; rows run from its top for its height.
+struct FrameMask {
+    uint8_t x;
+    uint8_t y;
+    uint8_t w;
+    uint8_t h;
+    const uint64_t* right;  // Rows facing right
+    const uint64_t* left;   // The same rows mirrored, for a fighter facing left
+};
+
+#include "images/sprite_masks.h"
+
+// Everything needed to draw one fighter
+struct SpriteSet {
+    const SpriteFrame* frames;       // Frames, indexed by image index
+    const unsigned short* palette;   // RGB565 colour for each palette index
+};
+
+const SpriteSet red_sprite_set = { fighter_frames, sprite_palette_red };
+const SpriteSet blue_sprite_set = { fighter_frames, sprite_palette_blue };
 
 
 // Old arrays removed - left sprites deleted, using runtime flipping instead
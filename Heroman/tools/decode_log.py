@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Decode the binary event log written by src/event_log.h.
+
+Binary frames are mixed in with the ordinary text the firmware prints, so
+text is passed through unchanged and each frame is replaced by its formatted
+line, prefixed with the tick number. Event names and format strings come from
+the LOG_EVENTS table in src/event_log.h, so the decoder never goes stale.
+
+    python3 tools/decode_log.py capture.bin
+    pio device monitor --raw | python3 tools/decode_log.py
+"""
+
+import os
+import re
+import struct
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+EVENT_LOG_HEADER = os.path.join(ROOT, "src", "event_log.h")
+
+SYNC = b"\xA5\x5A"
+ARG_COUNT = 4
+BODY_FORMAT = "<HI%di" % ARG_COUNT
+FRAME_SIZE = len(SYNC) + struct.calcsize(BODY_FORMAT) + 1  # + checksum
+
+
+def load_events(path=EVENT_LOG_HEADER):
+    """Return [(name, category, format)] in event ID order."""
+    with open(path) as f:
+        text = f.read()
+    table = text[text.index("#define LOG_EVENTS(X)"):]
+    table = table[:table.index("\n\n")]
+    return re.findall(r'X\((\w+),\s*(\w+),\s*"((?:[^"\\]|\\.)*)"\)', table)
+
+
+def format_event(events, event, args):
+    if event >= len(events):
+        return "unknown event %d %s" % (event, list(args))
+    name, _, fmt = events[event]
+    fmt = fmt.encode().decode("unicode_escape")
+
+    # Hex and unsigned conversions print the raw 32-bit value
+    values = []
+    for conversion, arg in zip(re.findall(r"%[-#0-9.]*([a-zA-Z])", fmt), args):
+        values.append(arg & 0xFFFFFFFF if conversion in "xXu" else arg)
+    try:
+        return fmt % tuple(values)
+    except (TypeError, ValueError):
+        return "%s %s" % (name, list(args))
+
+
+def decode(data, events, out):
+    """Write text and decoded frames from data to out; return unconsumed bytes."""
+    pos = 0
+    while True:
+        start = data.find(SYNC, pos)
+        if start < 0:
+            # Keep a trailing 0xA5 in case the sync is split across reads
+            keep = len(data) - 1 if data.endswith(SYNC[:1]) else len(data)
+            out.write(data[pos:keep].decode("utf-8", "replace"))
+            return data[keep:]
+
+        if len(data) - start < FRAME_SIZE:
+            out.write(data[pos:start].decode("utf-8", "replace"))
+            return data[start:]
+
+        body = data[start + len(SYNC):start + FRAME_SIZE - 1]
+        checksum = data[start + FRAME_SIZE - 1]
+        if sum(body) & 0xFF != checksum:
+            # Not a frame after all - treat the sync byte as text
+            out.write(data[pos:start + 1].decode("utf-8", "replace"))
+            pos = start + 1
+            continue
+
+        out.write(data[pos:start].decode("utf-8", "replace"))
+        fields = struct.unpack(BODY_FORMAT, body)
+        event, tick, args = fields[0], fields[1], fields[2:]
+        out.write("[%7d] %s\n" % (tick, format_event(events, event, args)))
+        pos = start + FRAME_SIZE
+
+
+def main():
+    events = load_events()
+    stream = open(sys.argv[1], "rb") if len(sys.argv) > 1 else sys.stdin.buffer
+    pending = b""
+    while True:
+        chunk = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+        if not chunk:
+            break
+        pending = decode(pending + chunk, events, sys.stdout)
+        sys.stdout.flush()
+    if pending:
+        sys.stdout.write(pending.decode("utf-8", "replace"))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,340 @@
+#!/usr/bin/env python3
+"""Generate derived sprite data headers from the ImgConv sprite headers.
+
+Reads src/images/sprite_right_{red,blue}_NN.h and writes the tables that the
+game used to compute at runtime, plus each frame's combat boxes and
+collision masks. Re-run after
+changing any sprite image:
+
+    python3 tools/gen_sprites.py
+"""
+
+import os
+import re
+
+FRAME_WIDTH = 46
+FRAME_HEIGHT = 50
+FRAME_COUNT = 28
+TRANSPARENT_COLOR = 0x0000
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+IMAGES_DIR = os.path.join(ROOT, "src", "images")
+SETS = ("red", "blue")
+PALETTE_SIZE = 16  # 4-bit indices
+
+# Combat boxes (see write_boxes)
+HURTBOX_BANDS = 3       # Hurtboxes per frame: head, body, legs
+HITBOX_DEPTH = 6        # Columns behind the tip of a punch that hit
+HITBOX_REACH_ROWS = 0.6  # The tip is searched for in this top part of the frame (feet stick out too)
+ATTACK_FRAMES = (3, 4, 17, 18)  # Punch frames - keep in step with ANIMATIONS in animation.h
+
+
+def load_frame(color, index):
+    """Return the frame's pixels as a list, or None for a stubbed-out frame."""
+    path = os.path.join(IMAGES_DIR, "sprite_right_%s_%02d.h" % (color, index))
+    with open(path) as f:
+        text = f.read()
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    body = text[text.index("{") + 1:text.rindex("}")]
+    pixels = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)]
+    if len(pixels) != FRAME_WIDTH * FRAME_HEIGHT:
+        return None  # unused frame, kept as a 1-pixel placeholder
+    return pixels
+
+
+def build_palettes(frames):
+    """Map every opaque pixel to a shared palette index.
+
+    The colour sets must share silhouettes; each index stands for one
+    combination of colours across the sets (red skin + blue skin, ...).
+    """
+    combos = set()
+    for index in range(FRAME_COUNT):
+        per_set = [frames[color][index] for color in SETS]
+        if any(p is None for p in per_set):
+            if not all(p is None for p in per_set):
+                raise SystemExit("frame %d is stubbed in some sets but not others" % index)
+            continue
+        for pixel in zip(*per_set):
+            opaque = [p != TRANSPARENT_COLOR for p in pixel]
+            if any(opaque) != all(opaque):
+                raise SystemExit("frame %d: colour sets do not share a silhouette" % index)
+            if all(opaque):
+                combos.add(pixel)
+    combos = sorted(combos)
+    if len(combos) > PALETTE_SIZE:
+        raise SystemExit("%d colours do not fit a %d entry palette" % (len(combos), PALETTE_SIZE))
+    lookup = {combo: i for i, combo in enumerate(combos)}
+    palettes = {color: [combo[n] for combo in combos] for n, color in enumerate(SETS)}
+    return lookup, palettes
+
+
+def trim_rect(pixels):
+    """Tightest (x, y, w, h) box around the frame's opaque pixels."""
+    xs = [i % FRAME_WIDTH for i, p in enumerate(pixels) if p != TRANSPARENT_COLOR]
+    ys = [i // FRAME_WIDTH for i, p in enumerate(pixels) if p != TRANSPARENT_COLOR]
+    if not xs:
+        return (0, 0, 0, 0)
+    return (min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1)
+
+
+def encode_spans(per_set, lookup, trim):
+    """Run-length encode a frame's trimmed area into opaque spans of 4-bit palette indices.
+
+    Per trimmed row: one byte with the span count, then for each span the
+    columns skipped since the previous span (or the trim edge), the run
+    length, and the run's palette indices packed two per byte (first pixel
+    in the high nibble). Transparent pixels are never stored.
+    """
+    trim_x, trim_y, trim_w, trim_h = trim
+    data = []
+    for y in range(trim_y, trim_y + trim_h):
+        first = y * FRAME_WIDTH + trim_x
+        row = [lookup.get(pixel) for pixel in zip(*[p[first:first + trim_w] for p in per_set])]
+        spans = []
+        x = 0
+        last_end = 0
+        while x < trim_w:
+            if row[x] is None:
+                x += 1
+                continue
+            start = x
+            while x < trim_w and row[x] is not None:
+                x += 1
+            spans.append((start - last_end, row[start:x]))
+            last_end = x
+        data.append(len(spans))
+        for skip, run in spans:
+            data.append(skip)
+            data.append(len(run))
+            for i in range(0, len(run), 2):
+                low = run[i + 1] if i + 1 < len(run) else 0
+                data.append((run[i] << 4) | low)
+    return data
+
+
+def format_bytes(data, per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(", ".join("0x%02X" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def format_palette(entries):
+    return ", ".join("0x%04X" % w for w in entries)
+
+
+def write_spans(frames):
+    lookup, palettes = build_palettes(frames)
+
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// Generated by  : tools/gen_sprites.py - do not edit by hand")
+    out.append("// Generated from: sprite_right_{%s}_NN.h" % ",".join(SETS))
+    out.append("// Dimensions    : %dx%d pixels, right facing" % (FRAME_WIDTH, FRAME_HEIGHT))
+    out.append("//")
+    out.append("// Span-encoded, palette-indexed sprite frames shared by every fighter colour.")
+    out.append("// Each frame is trimmed to the box around its opaque pixels. For each row of")
+    out.append("// the trimmed box:")
+    out.append("//   span count")
+    out.append("//   per span: columns skipped, run length, then the run's 4-bit palette")
+    out.append("//             indices packed two per byte (high nibble first)")
+    out.append("// Unused frames have an empty box.")
+    out.append("")
+    out.append("#define SPRITE_PALETTE_SIZE %d" % PALETTE_SIZE)
+    out.append("")
+    for color in SETS:
+        entries = palettes[color] + [0] * (PALETTE_SIZE - len(palettes[color]))
+        out.append("const unsigned short sprite_palette_%s[SPRITE_PALETTE_SIZE] PROGMEM = { %s };" % (color, format_palette(entries)))
+    out.append("")
+    out.append("const uint8_t sprite_spans_empty[1] PROGMEM = { 0 };")
+    out.append("")
+
+    total = 0
+    entries = []
+    for index in range(FRAME_COUNT):
+        per_set = [frames[color][index] for color in SETS]
+        if per_set[0] is None:
+            entries.append("{  0,  0,  0,  0, sprite_spans_empty },")
+            continue
+        name = "sprite_spans_%02d" % index
+        trim = trim_rect(per_set[0])
+        data = encode_spans(per_set, lookup, trim)
+        total += len(data)
+        out.append("// Frame %d: trimmed to %dx%d at (%d, %d)" % (index, trim[2], trim[3], trim[0], trim[1]))
+        out.append("const uint8_t %s[%d] PROGMEM = {" % (name, len(data)))
+        out.append(format_bytes(data))
+        out.append("};")
+        out.append("")
+        entries.append("{ %2d, %2d, %2d, %2d, %s }," % (trim + (name,)))
+
+    out.append("// { trimX, trimY, trimWidth, trimHeight, spans }")
+    out.append("const SpriteFrame fighter_frames[] = {")
+    out.append("\n".join("    %s" % e for e in entries))
+    out.append("};")
+    out.append("")
+
+    with open(os.path.join(IMAGES_DIR, "sprite_spans.h"), "w") as f:
+        f.write("\n".join(out))
+    return total
+
+
+def opaque_box(pixels, x0, y0, x1, y1):
+    """Tightest (x, y, w, h) box around opaque pixels in [x0, x1) x [y0, y1), or None."""
+    xs = []
+    ys = []
+    for y in range(y0, y1):
+        for x in range(x0, x1):
+            if pixels[y * FRAME_WIDTH + x] != TRANSPARENT_COLOR:
+                xs.append(x)
+                ys.append(y)
+    if not xs:
+        return None
+    return (min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1)
+
+
+def row_front(pixels, y):
+    """Rightmost opaque column in row y, or -1."""
+    for x in range(FRAME_WIDTH - 1, -1, -1):
+        if pixels[y * FRAME_WIDTH + x] != TRANSPARENT_COLOR:
+            return x
+    return -1
+
+
+def frame_boxes(pixels, attack):
+    """Hurtboxes and hitboxes of one right-facing frame.
+
+    Hurtboxes: the silhouette cut into HURTBOX_BANDS horizontal bands, each
+    boxed tightly, so a crouch or an outstretched arm changes where the
+    fighter can be hit. Hitbox: for punch frames, the fist - the forward-most
+    point of the upper body and the rows around it that reach within
+    HITBOX_DEPTH columns of it.
+    """
+    trim_x, trim_y, trim_w, trim_h = trim_rect(pixels)
+    hurt = []
+    for band in range(HURTBOX_BANDS):
+        top = trim_y + trim_h * band // HURTBOX_BANDS
+        bottom = trim_y + trim_h * (band + 1) // HURTBOX_BANDS
+        box = opaque_box(pixels, trim_x, top, trim_x + trim_w, bottom)
+        if box:
+            hurt.append(box)
+    hit = []
+    if attack:
+        rows = range(trim_y, trim_y + int(trim_h * HITBOX_REACH_ROWS))
+        tip_row = max(rows, key=lambda y: (row_front(pixels, y), -y))
+        tip = row_front(pixels, tip_row)
+        reaches = lambda y: trim_y <= y < trim_y + trim_h and row_front(pixels, y) > tip - HITBOX_DEPTH
+        top = tip_row
+        while reaches(top - 1):
+            top -= 1
+        bottom = tip_row + 1
+        while reaches(bottom):
+            bottom += 1
+        hit.append(opaque_box(pixels, tip - HITBOX_DEPTH + 1, top, tip + 1, bottom))
+    return hurt, hit
+
+
+def format_box_list(boxes, size):
+    boxes = boxes + [(0, 0, 0, 0)] * (size - len(boxes))
+    return "{ %s }" % ", ".join("{ %2d, %2d, %2d, %2d }" % b for b in boxes)
+
+
+def write_boxes(frames):
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// Generated by  : tools/gen_sprites.py - do not edit by hand")
+    out.append("// Generated from: sprite_right_%s_NN.h" % SETS[0])
+    out.append("//")
+    out.append("// Combat boxes for every sprite frame, in the right-facing %dx%d cell." % (FRAME_WIDTH, FRAME_HEIGHT))
+    out.append("// Hurtboxes are the silhouette in %d horizontal bands; punch frames" % HURTBOX_BANDS)
+    out.append("// (%s) have a hitbox over the last %d columns of the fist." % (", ".join(str(f) for f in ATTACK_FRAMES), HITBOX_DEPTH))
+    out.append("")
+    out.append("// { hurtCount, hitCount, { hurt { x, y, w, h } }, { hit { x, y, w, h } } }")
+    out.append("constexpr FrameBoxes fighter_boxes[%d] = {" % FRAME_COUNT)
+    for index in range(FRAME_COUNT):
+        pixels = frames[SETS[0]][index]
+        hurt, hit = ([], []) if pixels is None else frame_boxes(pixels, index in ATTACK_FRAMES)
+        out.append("    { %d, %d, %s, %s },  // Frame %d" % (len(hurt), len(hit), format_box_list(hurt, HURTBOX_BANDS),
+                                                         format_box_list(hit, 1), index))
+    out.append("};")
+    out.append("")
+
+    with open(os.path.join(IMAGES_DIR, "sprite_boxes.h"), "w") as f:
+        f.write("\n".join(out))
+
+
+def row_mask(pixels, y, mirror):
+    """Row y as a bitmask, bit x set for an opaque column x (mirrored: column FRAME_WIDTH - 1 - x)."""
+    mask = 0
+    for x in range(FRAME_WIDTH):
+        if pixels[y * FRAME_WIDTH + x] != TRANSPARENT_COLOR:
+            mask |= 1 << (FRAME_WIDTH - 1 - x if mirror else x)
+    return mask
+
+
+def format_masks(masks, per_line=4):
+    lines = []
+    for i in range(0, len(masks), per_line):
+        lines.append(", ".join("0x%012XULL" % m for m in masks[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_masks(frames):
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// Generated by  : tools/gen_sprites.py - do not edit by hand")
+    out.append("// Generated from: sprite_right_%s_NN.h" % SETS[0])
+    out.append("//")
+    out.append("// Collision masks for every sprite frame: one uint64_t per row of the")
+    out.append("// frame's trimmed box, bit x set when column x of the %d-wide cell is opaque." % FRAME_WIDTH)
+    out.append("// Each frame has the right-facing rows and the same rows mirrored for a")
+    out.append("// left-facing fighter, so no bits are reversed at runtime.")
+    out.append("")
+    out.append("const uint64_t sprite_mask_empty[1] PROGMEM = { 0 };")
+    out.append("")
+
+    total = 0
+    entries = []
+    for index in range(FRAME_COUNT):
+        pixels = frames[SETS[0]][index]
+        if pixels is None:
+            entries.append("{  0,  0,  0,  0, sprite_mask_empty, sprite_mask_empty },")
+            continue
+        trim = trim_rect(pixels)
+        rows = range(trim[1], trim[1] + trim[3])
+        for side, mirror in (("right", False), ("left", True)):
+            masks = [row_mask(pixels, y, mirror) for y in rows]
+            total += 8 * len(masks)
+            out.append("const uint64_t sprite_mask_%02d_%s[%d] PROGMEM = {" % (index, side, len(masks)))
+            out.append(format_masks(masks))
+            out.append("};")
+        out.append("")
+        entries.append("{ %2d, %2d, %2d, %2d, sprite_mask_%02d_right, sprite_mask_%02d_left }," % (trim + (index, index)))
+
+    out.append("// { x, y, w, h, right, left } - the box is in the right-facing cell")
+    out.append("const FrameMask fighter_masks[%d] = {" % FRAME_COUNT)
+    out.append("\n".join("    %s" % e for e in entries))
+    out.append("};")
+    out.append("")
+
+    with open(os.path.join(IMAGES_DIR, "sprite_masks.h"), "w") as f:
+        f.write("\n".join(out))
+    return total
+
+
+def main():
+    frames = {color: [load_frame(color, i) for i in range(FRAME_COUNT)] for color in SETS}
+    total = write_spans(frames)
+    print("sprite_spans.h: %d bytes of span data" % total)
+    write_boxes(frames)
+    print("sprite_boxes.h: %d frames" % FRAME_COUNT)
+    total = write_masks(frames)
+    print("sprite_masks.h: %d bytes of row masks" % total)
+
+
+if __name__ == "__main__":
+    main()